@@ -0,0 +1,138 @@
+// Copyright 2025 Dalton Prokosch
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <map>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "sBTree.hpp"
+
+// Inserts the same random keys into SBTree and std::map, then runs random point lookups and short range scans
+// against both, reporting ns per operation. Checksums have to match.
+
+using Clock = std::chrono::steady_clock;
+
+constexpr size_t KEYS = 4'000'000;
+constexpr size_t LOOKUPS = 2'000'000;
+constexpr size_t SCANS = 200'000;
+constexpr size_t SCAN_LENGTH = 100;
+
+template<typename FUNCTION>
+double time(FUNCTION&& function)
+{
+    Clock::time_point start = Clock::now();
+    function();
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+void report(const char* container, const char* workload, double seconds, size_t operations, uint64_t checksum)
+{
+    std::printf("%-10s %-8s %12.1f %20llu\n", container, workload, seconds * 1e9 / operations,
+        static_cast<unsigned long long>(checksum));
+}
+
+int main()
+{
+    std::mt19937 random(42);
+    std::vector<uint32_t> keys(KEYS);
+    for (uint32_t& key : keys)
+    {
+        key = random();
+    }
+    std::vector<uint32_t> probes(LOOKUPS);
+    for (size_t i = 0; i < LOOKUPS; i++)
+    {
+        // half of the probes hit
+        probes[i] = (i & 1) ? keys[random() % KEYS] : random();
+    }
+
+    std::printf("%-10s %-8s %12s %20s\n", "container", "workload", "ns/op", "checksum");
+    {
+        std::unique_ptr<svec::SBTree<uint32_t, uint64_t>> tree = std::make_unique<svec::SBTree<uint32_t, uint64_t>>();
+        double seconds = time([&]()
+        {
+            for (uint32_t key : keys)
+            {
+                tree->insert(key, key * 3ull);
+            }
+        });
+        report("SBTree", "insert", seconds, KEYS, tree->size());
+
+        uint64_t checksum = 0;
+        seconds = time([&]()
+        {
+            for (uint32_t probe : probes)
+            {
+                const uint64_t* value = tree->find(probe);
+                checksum += value ? *value : 1;
+            }
+        });
+        report("SBTree", "point", seconds, LOOKUPS, checksum);
+
+        checksum = 0;
+        seconds = time([&]()
+        {
+            for (size_t i = 0; i < SCANS; i++)
+            {
+                auto it = tree->lowerBound(probes[i]);
+                for (size_t j = 0; j < SCAN_LENGTH && it != tree->end(); j++, ++it)
+                {
+                    checksum += it.value();
+                }
+            }
+        });
+        report("SBTree", "range", seconds, SCANS, checksum);
+    }
+    {
+        std::unique_ptr<std::map<uint32_t, uint64_t>> map = std::make_unique<std::map<uint32_t, uint64_t>>();
+        double seconds = time([&]()
+        {
+            for (uint32_t key : keys)
+            {
+                map->emplace(key, key * 3ull);
+            }
+        });
+        report("std::map", "insert", seconds, KEYS, map->size());
+
+        uint64_t checksum = 0;
+        seconds = time([&]()
+        {
+            for (uint32_t probe : probes)
+            {
+                auto found = map->find(probe);
+                checksum += found != map->end() ? found->second : 1;
+            }
+        });
+        report("std::map", "point", seconds, LOOKUPS, checksum);
+
+        checksum = 0;
+        seconds = time([&]()
+        {
+            for (size_t i = 0; i < SCANS; i++)
+            {
+                auto it = map->lower_bound(probes[i]);
+                for (size_t j = 0; j < SCAN_LENGTH && it != map->end(); j++, ++it)
+                {
+                    checksum += it->second;
+                }
+            }
+        });
+        report("std::map", "range", seconds, SCANS, checksum);
+    }
+    return 0;
+}
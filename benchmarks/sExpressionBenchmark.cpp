@@ -0,0 +1,124 @@
+// Copyright 2025 Dalton Prokosch
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+
+#include "sExpression.hpp"
+
+// Runs element-wise kernels and reductions on SVector<float, 256> three ways: as a hand written loop over
+// operator[] and size(), as the sequential svec::reference loop and through the expression templates.
+// Reports ns per call, the checksums of each group have to agree (reductions up to rounding).
+
+using Clock = std::chrono::steady_clock;
+using Vec = svec::SVector<float, 256>;
+
+constexpr size_t ITERATIONS = 2'000'000;
+
+/**
+ * @brief Keeps the compiler from hoisting work out of the timing loop
+ */
+template<typename T>
+inline void escape(T& value)
+{
+    asm volatile("" : : "g"(&value) : "memory");
+}
+
+template<typename FUNCTION>
+void run(const char* name, FUNCTION&& function)
+{
+    double checksum = 0;
+    Clock::time_point start = Clock::now();
+    for (size_t i = 0; i < ITERATIONS; i++)
+    {
+        checksum += function();
+    }
+    double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    std::printf("%-28s %10.2f %18.6g\n", name, seconds * 1e9 / ITERATIONS, checksum / ITERATIONS);
+}
+
+int main()
+{
+    std::mt19937 random(1);
+    std::uniform_real_distribution<float> values(-1.0f, 1.0f);
+    Vec a;
+    Vec b;
+    Vec c;
+    for (size_t i = 0; i < 256; i++)
+    {
+        a.pushBack(0.0f);
+        b.pushBack(values(random));
+        c.pushBack(values(random));
+    }
+
+    std::printf("%-28s %10s %18s\n", "kernel", "ns/call", "checksum");
+    run("a = b * 2 + c (hand loop)", [&]()
+    {
+        escape(b);
+        for (size_t i = 0; i < b.size(); i++)
+        {
+            a[i] = b[i] * 2.0f + c[i];
+        }
+        escape(a);
+        return a[7];
+    });
+    run("a = b * 2 + c (expression)", [&]()
+    {
+        escape(b);
+        a = b * 2.0f + c;
+        escape(a);
+        return a[7];
+    });
+    run("clamp(b + c) (hand loop)", [&]()
+    {
+        escape(b);
+        for (size_t i = 0; i < b.size(); i++)
+        {
+            float value = b[i] + c[i];
+            a[i] = value < -0.5f ? -0.5f : (value > 0.5f ? 0.5f : value);
+        }
+        escape(a);
+        return a[7];
+    });
+    run("clamp(b + c) (expression)", [&]()
+    {
+        escape(b);
+        a = svec::clamp(b + c, -0.5f, 0.5f);
+        escape(a);
+        return a[7];
+    });
+
+    run("sum (hand loop)", [&]()
+    {
+        escape(b);
+        float total = 0;
+        for (size_t i = 0; i < b.size(); i++)
+        {
+            total += b[i];
+        }
+        return total;
+    });
+    run("sum (reference)", [&]() { escape(b); return svec::reference::sum(b); });
+    run("sum (lanes)", [&]() { escape(b); return svec::sum(b); });
+    run("dot (reference)", [&]() { escape(b); return svec::reference::dot(b, c); });
+    run("dot (lanes)", [&]() { escape(b); return svec::dot(b, c); });
+    run("max (reference)", [&]() { escape(b); return svec::reference::max(b); });
+    run("max (lanes)", [&]() { escape(b); return svec::max(b); });
+    run("argmax (reference)", [&]() { escape(b); return static_cast<float>(svec::reference::argmax(b)); });
+    run("argmax (lanes)", [&]() { escape(b); return static_cast<float>(svec::argmax(b)); });
+    run("norm (reference)", [&]() { escape(b); return svec::reference::norm(b); });
+    run("norm (lanes)", [&]() { escape(b); return svec::norm(b); });
+    return 0;
+}
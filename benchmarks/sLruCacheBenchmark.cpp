@@ -0,0 +1,127 @@
+// Copyright 2025 Dalton Prokosch
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <list>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+#include "sLruCache.hpp"
+
+// Runs the same skewed get-or-put key stream through SLruCache and a std::list plus std::unordered_map LRU,
+// reporting hit rate (which has to match) and average latency per lookup.
+
+using Clock = std::chrono::steady_clock;
+
+constexpr size_t OPERATIONS = 2'000'000;
+
+struct Decoded
+{
+    uint64_t fields[4];
+};
+
+template<size_t CAPACITY>
+class StdLruCache
+{
+public:
+    Decoded* get(uint64_t key)
+    {
+        auto found = m_index.find(key);
+        if (found == m_index.end())
+        {
+            return nullptr;
+        }
+        m_order.splice(m_order.begin(), m_order, found->second);
+        return &found->second->second;
+    }
+    Decoded& put(uint64_t key, Decoded value)
+    {
+        if (m_order.size() == CAPACITY)
+        {
+            m_index.erase(m_order.back().first);
+            m_order.pop_back();
+        }
+        m_order.emplace_front(key, value);
+        m_index[key] = m_order.begin();
+        return m_order.front().second;
+    }
+
+private:
+    std::list<std::pair<uint64_t, Decoded>> m_order;
+    std::unordered_map<uint64_t, std::list<std::pair<uint64_t, Decoded>>::iterator> m_index;
+};
+
+/**
+ * @brief Keys drawn from a Zipf-like distribution over keySpace keys, so a few keys are hot and most are cold
+ */
+std::vector<uint64_t> makeKeys(size_t keySpace)
+{
+    std::mt19937_64 random(keySpace);
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+    std::vector<uint64_t> keys(OPERATIONS);
+    for (uint64_t& key : keys)
+    {
+        double rank = std::pow(static_cast<double>(keySpace), uniform(random)) - 1.0;
+        key = static_cast<uint64_t>(rank) * 0x9E3779B97F4A7C15ull;
+    }
+    return keys;
+}
+
+template<typename CACHE>
+void run(const char* name, size_t capacity, const std::vector<uint64_t>& keys)
+{
+    CACHE* cache = new CACHE();
+    size_t hits = 0;
+    uint64_t checksum = 0;
+    Clock::time_point start = Clock::now();
+    for (uint64_t key : keys)
+    {
+        Decoded* value = cache->get(key);
+        if (value)
+        {
+            hits++;
+        }
+        else
+        {
+            value = &cache->put(key, Decoded{{key, key + 1, key + 2, key + 3}});
+        }
+        checksum += value->fields[1];
+    }
+    double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    std::printf("%-14s %9zu %9.2f%% %12.1f %20llu\n", name, capacity, 100.0 * hits / keys.size(),
+        seconds * 1e9 / keys.size(), static_cast<unsigned long long>(checksum));
+    delete cache;
+}
+
+template<size_t CAPACITY>
+void compare()
+{
+    std::vector<uint64_t> keys = makeKeys(CAPACITY * 16);
+    run<svec::SLruCache<uint64_t, Decoded, CAPACITY>>("SLruCache", CAPACITY, keys);
+    run<StdLruCache<CAPACITY>>("std LRU", CAPACITY, keys);
+}
+
+int main()
+{
+    std::printf("%-14s %9s %10s %12s %20s\n", "cache", "capacity", "hit rate", "ns/lookup", "checksum");
+    compare<64>();
+    compare<256>();
+    compare<1024>();
+    compare<16384>();
+    return 0;
+}
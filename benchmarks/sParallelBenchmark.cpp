@@ -0,0 +1,115 @@
+// Copyright 2025 Dalton Prokosch
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstdio>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <thread>
+
+#include "sMappedVector.hpp"
+#include "sParallel.hpp"
+
+// Strong scaling of the svec::parallel algorithms over a SMappedVector of 4M int64 keys, from 1 thread up to every core.
+// One thread is the sequential path, the std algorithms over the SVector iterators are printed as a baseline.
+// The first argument overrides the max amount of threads.
+
+using Clock = std::chrono::steady_clock;
+
+constexpr size_t ELEMENTS = 1 << 22;
+
+using Keys = svec::SMappedVector<int64_t, ELEMENTS>;
+using Values = svec::SMappedVector<double, ELEMENTS>;
+
+template<typename PREPARE, typename FUNCTION>
+double bestSeconds(const PREPARE& prepare, const FUNCTION& function)
+{
+    double best = 1e9;
+    for (int repeat = 0; repeat < 5; repeat++)
+    {
+        prepare();
+        Clock::time_point start = Clock::now();
+        function();
+        best = std::min(best, std::chrono::duration<double>(Clock::now() - start).count());
+    }
+    return best;
+}
+
+int main(int argc, char** argv)
+{
+    Keys input;
+    Keys keys;
+    Values values;
+    std::mt19937_64 random(3);
+    for (size_t i = 0; i < ELEMENTS; i++)
+    {
+        input.pushBack(static_cast<int64_t>(random() >> 1));
+    }
+    auto refill = [&]()
+    {
+        keys.resizeForOverwrite(ELEMENTS);
+        std::copy(input.begin(), input.end(), keys.begin());
+    };
+    auto nothing = []() {};
+    auto work = [](int64_t key) { return std::sqrt(static_cast<double>(key & 0xFFFFF)) * 1.5; };
+
+    std::unique_ptr<svec::SVector<int64_t, ELEMENTS>> vec = std::make_unique<svec::SVector<int64_t, ELEMENTS>>();
+    auto refillVector = [&]()
+    {
+        vec->resizeForOverwrite(ELEMENTS);
+        std::copy(input.begin(), input.end(), vec->begin());
+    };
+    double stdSort = bestSeconds(refillVector, [&]() { std::sort(vec->begin(), vec->end()); });
+    std::printf("std::sort over SVector iterators: %.2f ms\n\n", stdSort * 1e3);
+
+    size_t maxThreads = argc > 1 ? std::max(1, std::atoi(argv[1])) : std::max(1u, std::thread::hardware_concurrency());
+    double base[5] = {};
+    std::printf("%8s %18s %18s %18s %18s %18s\n", "threads", "sort ms (x)", "transform ms (x)", "reduce ms (x)",
+                "scan ms (x)", "forEach ms (x)");
+    for (size_t threads = 1; threads <= maxThreads; threads *= 2)
+    {
+        svec::SThreadPool pool(threads - 1);
+        int64_t checksum = 0;
+        double seconds[5] = {};
+        seconds[0] = bestSeconds(refill, [&]() { svec::parallel::sort(pool, keys); });
+        checksum += keys[ELEMENTS / 2];
+        seconds[1] = bestSeconds(nothing, [&]() { svec::parallel::transform(pool, input, values, work); });
+        checksum += static_cast<int64_t>(values[ELEMENTS / 3]);
+        seconds[2] = bestSeconds(nothing, [&]() { checksum += svec::parallel::reduce(pool, input, int64_t{0}) & 0xFFFF; });
+        seconds[3] = bestSeconds(refill, [&]() { svec::parallel::inclusiveScan(pool, input, keys); });
+        checksum += keys[ELEMENTS - 1];
+        seconds[4] = bestSeconds(refill, [&]() { svec::parallel::forEach(pool, keys, [](int64_t& key) { key = key * 31 + 7; }); });
+        checksum += keys[ELEMENTS / 5];
+
+        std::printf("%8zu", threads);
+        for (size_t i = 0; i < 5; i++)
+        {
+            if (threads == 1)
+            {
+                base[i] = seconds[i];
+            }
+            std::printf(" %10.2f (%5.2f)", seconds[i] * 1e3, base[i] / seconds[i]);
+        }
+        std::printf("   (checksum %lld)\n", static_cast<long long>(checksum));
+        if (threads < maxThreads && threads * 2 > maxThreads)
+        {
+            threads = maxThreads / 2;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,134 @@
+// Copyright 2025 Dalton Prokosch
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <numeric>
+#include <random>
+
+#include "sPermutation.hpp"
+
+// Reorders structure of arrays columns by a sort order in place with svec::permuteTogether and through copies of
+// every column, then gathers and scatters 4 and 8 byte columns with svec::gather and svec::scatter and with plain loops.
+// Reports ns per element and the scratch bytes each reorder needs, the checksums have to match.
+
+using Clock = std::chrono::steady_clock;
+
+constexpr size_t CAPACITY = 1 << 16;
+constexpr size_t ROUNDS = 100;
+
+using Index = svec::SVector<uint32_t, CAPACITY>;
+
+struct Columns
+{
+    svec::SVector<uint32_t, CAPACITY> ids;
+    svec::SVector<double, CAPACITY> prices;
+    svec::SVector<uint64_t, CAPACITY> stamps;
+};
+
+template<typename FUNCTION>
+void run(const char* name, size_t elements, size_t scratch, FUNCTION&& function)
+{
+    uint64_t checksum = 0;
+    Clock::time_point start = Clock::now();
+    for (size_t round = 0; round < ROUNDS; round++)
+    {
+        checksum += function();
+    }
+    double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    std::printf("  %-24s %10.3f %12zu %22llu\n", name, seconds * 1e9 / (ROUNDS * elements), scratch,
+                static_cast<unsigned long long>(checksum));
+}
+
+int main()
+{
+    std::mt19937 random(5);
+    std::unique_ptr<Index> order = std::make_unique<Index>();
+    std::unique_ptr<Columns> columns = std::make_unique<Columns>();
+    for (size_t i = 0; i < CAPACITY; i++)
+    {
+        columns->ids.pushBack(random());
+        columns->prices.pushBack(random() * 0.25);
+        columns->stamps.pushBack(i);
+        order->pushBack(static_cast<uint32_t>(i));
+    }
+    std::shuffle(order->data(), order->data() + order->size(), random);
+    std::unique_ptr<Columns> original = std::make_unique<Columns>(*columns);
+
+    std::printf("  %-24s %10s %12s %22s\n", "reorder", "ns/elem", "scratch", "checksum");
+    run("svec::permuteTogether", CAPACITY, sizeof(std::bitset<CAPACITY>), [&]()
+    {
+        svec::permuteTogether(*order, columns->ids, columns->prices, columns->stamps);
+        return columns->stamps[0] + columns->ids[1];
+    });
+    *columns = *original;
+    std::unique_ptr<Columns> copies = std::make_unique<Columns>();
+    run("copy every column", CAPACITY, sizeof(Columns), [&]()
+    {
+        svec::gather(columns->ids, *order, copies->ids);
+        svec::gather(columns->prices, *order, copies->prices);
+        svec::gather(columns->stamps, *order, copies->stamps);
+        columns->ids = copies->ids;
+        columns->prices = copies->prices;
+        columns->stamps = copies->stamps;
+        return columns->stamps[0] + columns->ids[1];
+    });
+
+    std::printf("\n  %-24s %10s %12s %22s\n", "gather/scatter", "ns/elem", "", "checksum");
+    std::unique_ptr<Columns> out = std::make_unique<Columns>();
+    out->ids.resize(CAPACITY);
+    out->stamps.resize(CAPACITY);
+    run("svec::gather 4 byte", CAPACITY, 0, [&]()
+    {
+        svec::gather(columns->ids, *order, out->ids);
+        return out->ids[CAPACITY / 2];
+    });
+    run("loop gather 4 byte", CAPACITY, 0, [&]()
+    {
+        for (size_t i = 0; i < CAPACITY; i++)
+        {
+            out->ids[i] = columns->ids[(*order)[i]];
+        }
+        return out->ids[CAPACITY / 2];
+    });
+    run("svec::gather 8 byte", CAPACITY, 0, [&]()
+    {
+        svec::gather(columns->stamps, *order, out->stamps);
+        return out->stamps[CAPACITY / 2];
+    });
+    run("loop gather 8 byte", CAPACITY, 0, [&]()
+    {
+        for (size_t i = 0; i < CAPACITY; i++)
+        {
+            out->stamps[i] = columns->stamps[(*order)[i]];
+        }
+        return out->stamps[CAPACITY / 2];
+    });
+    run("svec::scatter 4 byte", CAPACITY, 0, [&]()
+    {
+        svec::scatter(columns->ids, *order, out->ids);
+        return out->ids[CAPACITY / 2];
+    });
+    run("loop scatter 4 byte", CAPACITY, 0, [&]()
+    {
+        for (size_t i = 0; i < CAPACITY; i++)
+        {
+            out->ids[(*order)[i]] = columns->ids[i];
+        }
+        return out->ids[CAPACITY / 2];
+    });
+    return 0;
+}
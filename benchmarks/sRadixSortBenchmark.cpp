@@ -0,0 +1,129 @@
+// Copyright 2025 Dalton Prokosch
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <memory>
+#include <random>
+
+#include "sRadixSort.hpp"
+
+// Sorts copies of the same input with std::sort, std::stable_sort and svec::radixSort across sizes and key
+// distributions. Reports ns per element, the checksums of the sorted outputs have to match.
+
+using Clock = std::chrono::steady_clock;
+
+constexpr size_t CAPACITY = 1 << 16;
+constexpr size_t ELEMENTS_PER_SIZE = 1 << 22;
+
+/**
+ * @brief Record sorted by its key, payload travels with it
+ */
+struct Record
+{
+    uint32_t key;
+    uint32_t payload[3];
+};
+
+template<typename T>
+uint64_t checksum(const T& value)
+{
+    if constexpr (std::is_same_v<T, Record>)
+    {
+        return value.key * 31 + value.payload[0];
+    }
+    else
+    {
+        return static_cast<uint64_t>(value);
+    }
+}
+
+/**
+ * @brief Sorts consecutive slices of input so the branch predictor can not learn a repeated input
+ */
+template<typename T, typename KEY, typename FUNCTION>
+uint64_t run(const svec::SVector<T, CAPACITY>& input, svec::SVector<T, CAPACITY>& work, size_t size, KEY& key, FUNCTION& sort)
+{
+    size_t rounds = ELEMENTS_PER_SIZE / size;
+    uint64_t sum = 0;
+    Clock::duration elapsed{0};
+    for (size_t round = 0; round < rounds; round++)
+    {
+        const T* slice = input.data() + (round * size) % CAPACITY;
+        work.resizeForOverwrite(size);
+        std::copy(slice, slice + size, work.data());
+        Clock::time_point start = Clock::now();
+        sort(work, key);
+        elapsed += Clock::now() - start;
+        sum += checksum(work[0]) + checksum(work[size / 3]) * 7 + checksum(work[size - 1]) * 13;
+    }
+    double seconds = std::chrono::duration<double>(elapsed).count();
+    std::printf(" %9.2f", seconds * 1e9 / (rounds * size));
+    return sum;
+}
+
+template<typename T, typename KEY, typename GENERATOR>
+void compare(const char* label, KEY key, GENERATOR&& generate)
+{
+    std::mt19937_64 random(17);
+    std::unique_ptr<svec::SVector<T, CAPACITY>> input = std::make_unique<svec::SVector<T, CAPACITY>>();
+    std::unique_ptr<svec::SVector<T, CAPACITY>> work = std::make_unique<svec::SVector<T, CAPACITY>>();
+    for (size_t i = 0; i < CAPACITY; i++)
+    {
+        input->pushBack(generate(random));
+    }
+
+    std::printf("%s\n  %-18s", label, "size");
+    for (size_t size = 16; size <= CAPACITY; size *= 4)
+    {
+        std::printf(" %9zu", size);
+    }
+    std::printf(" %12s", "checksum");
+    auto less = [&](const T& a, const T& b) { return key(a) < key(b); };
+    auto row = [&](const char* name, auto&& sort)
+    {
+        std::printf("\n  %-18s", name);
+        uint64_t sum = 0;
+        for (size_t size = 16; size <= CAPACITY; size *= 4)
+        {
+            sum += run(*input, *work, size, key, sort);
+        }
+        std::printf(" %12llu", static_cast<unsigned long long>(sum % 1'000'000'007));
+    };
+    row("std::sort", [&](auto& vec, KEY&) { std::sort(vec.data(), vec.data() + vec.size(), less); });
+    row("std::stable_sort", [&](auto& vec, KEY&) { std::stable_sort(vec.data(), vec.data() + vec.size(), less); });
+    row("svec::radixSort", [&](auto& vec, KEY& k) { svec::radixSort(vec, k); });
+    std::printf("\n");
+}
+
+int main()
+{
+    std::printf("ns per element\n");
+    std::identity identity;
+    compare<uint32_t>("uniform uint32", identity, [](std::mt19937_64& random) { return static_cast<uint32_t>(random()); });
+    compare<uint32_t>("uint32 below 256", identity, [](std::mt19937_64& random) { return static_cast<uint32_t>(random() % 256); });
+    compare<int64_t>("uniform int64", identity, [](std::mt19937_64& random) { return static_cast<int64_t>(random()); });
+    compare<float>("normal float", identity, [](std::mt19937_64& random)
+    {
+        return std::normal_distribution<float>(0.0f, 1000.0f)(random);
+    });
+    compare<Record>("16 byte records", [](const Record& record) { return record.key; }, [](std::mt19937_64& random)
+    {
+        uint32_t key = static_cast<uint32_t>(random());
+        return Record{key, {key, key + 1, key + 2}};
+    });
+    return 0;
+}
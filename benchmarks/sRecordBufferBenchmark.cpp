@@ -0,0 +1,128 @@
+// Copyright 2025 Dalton Prokosch
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <random>
+
+#include "sRecordBuffer.hpp"
+
+// Packs batches of small messages into 64 KiB and reads them back, once with SRecordBuffer and once by hand with
+// uint32_t length prefixes in a SVector<char, 65536>. Reports ns per message and bytes per batch, the checksums have to match.
+
+using Clock = std::chrono::steady_clock;
+
+constexpr size_t BATCH_BYTES = 65536;
+constexpr size_t MESSAGES = 1 << 10;
+constexpr size_t ROUNDS = 5000;
+
+/**
+ * @brief Message of 8 to 64 bytes, the first 8 bytes are a sequence number
+ */
+struct Message
+{
+    uint32_t size;
+    unsigned char bytes[64];
+};
+
+template<typename FUNCTION>
+void run(const char* name, FUNCTION&& function)
+{
+    uint64_t checksum = 0;
+    size_t bytes = 0;
+    Clock::time_point start = Clock::now();
+    for (size_t round = 0; round < ROUNDS; round++)
+    {
+        checksum += function(bytes);
+    }
+    double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    std::printf("  %-28s %10.2f %10zu %22llu\n", name, seconds * 1e9 / (ROUNDS * MESSAGES), bytes,
+                static_cast<unsigned long long>(checksum));
+}
+
+int main()
+{
+    std::mt19937 random(21);
+    std::unique_ptr<Message[]> messages = std::make_unique<Message[]>(MESSAGES);
+    for (size_t i = 0; i < MESSAGES; i++)
+    {
+        messages[i].size = 8 + random() % 57;
+        uint64_t sequence = i;
+        memcpy(messages[i].bytes, &sequence, sizeof(sequence));
+        memset(messages[i].bytes + sizeof(sequence), static_cast<int>(i), sizeof(messages[i].bytes) - sizeof(sequence));
+    }
+
+    std::printf("  %-28s %10s %10s %22s\n", "pack and read", "ns/msg", "bytes", "checksum");
+    std::unique_ptr<svec::SRecordBuffer<BATCH_BYTES>> records = std::make_unique<svec::SRecordBuffer<BATCH_BYTES>>();
+    run("SRecordBuffer append", [&](size_t& bytes)
+    {
+        records->clear();
+        for (size_t i = 0; i < MESSAGES; i++)
+        {
+            records->append(std::as_bytes(std::span<const unsigned char>(messages[i].bytes, messages[i].size)));
+        }
+        bytes = records->size();
+        uint64_t sum = 0;
+        for (std::span<const std::byte> record : *records)
+        {
+            sum += *reinterpret_cast<const uint64_t*>(record.data()) + record.size();
+        }
+        return sum;
+    });
+    run("SRecordBuffer prepare/commit", [&](size_t& bytes)
+    {
+        records->clear();
+        for (size_t i = 0; i < MESSAGES; i++)
+        {
+            std::span<std::byte> space = records->prepare(sizeof(messages[i].bytes));
+            memcpy(space.data(), messages[i].bytes, messages[i].size);
+            records->commit(messages[i].size);
+        }
+        bytes = records->size();
+        uint64_t sum = 0;
+        for (std::span<const std::byte> record : *records)
+        {
+            sum += *reinterpret_cast<const uint64_t*>(record.data()) + record.size();
+        }
+        return sum;
+    });
+
+    std::unique_ptr<svec::SVector<char, BATCH_BYTES>> manual = std::make_unique<svec::SVector<char, BATCH_BYTES>>();
+    run("manual length prefix", [&](size_t& bytes)
+    {
+        manual->clear();
+        for (size_t i = 0; i < MESSAGES; i++)
+        {
+            size_t offset = manual->size();
+            manual->resizeForOverwrite(offset + sizeof(uint32_t) + messages[i].size);
+            memcpy(manual->data() + offset, &messages[i].size, sizeof(uint32_t));
+            memcpy(manual->data() + offset + sizeof(uint32_t), messages[i].bytes, messages[i].size);
+        }
+        bytes = manual->size();
+        uint64_t sum = 0;
+        for (size_t offset = 0; offset < manual->size();)
+        {
+            uint32_t size;
+            uint64_t sequence;
+            memcpy(&size, manual->data() + offset, sizeof(size));
+            memcpy(&sequence, manual->data() + offset + sizeof(size), sizeof(sequence));
+            sum += sequence + size;
+            offset += sizeof(size) + size;
+        }
+        return sum;
+    });
+    return 0;
+}
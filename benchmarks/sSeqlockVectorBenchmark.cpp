@@ -0,0 +1,122 @@
+// Copyright 2025 Dalton Prokosch
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <vector>
+
+#include "sSeqlockVector.hpp"
+
+// Measures snapshot throughput of 1..N reader threads while one writer republishes the table,
+// seqlock against an SVector guarded by a std::shared_mutex.
+
+using Clock = std::chrono::steady_clock;
+
+constexpr size_t CAPACITY = 32;
+constexpr auto DURATION = std::chrono::milliseconds(300);
+constexpr auto WRITE_INTERVAL = std::chrono::microseconds(100);
+
+struct Entry
+{
+    uint64_t key;
+    uint64_t value;
+};
+
+class SharedMutexTable
+{
+public:
+    void load(svec::SVector<Entry, CAPACITY>& out) const
+    {
+        std::shared_lock<std::shared_mutex> lock(m_mutex);
+        out = m_data;
+    }
+    void store(const svec::SVector<Entry, CAPACITY>& elements)
+    {
+        std::unique_lock<std::shared_mutex> lock(m_mutex);
+        m_data = elements;
+    }
+
+private:
+    mutable std::shared_mutex m_mutex;
+    svec::SVector<Entry, CAPACITY> m_data;
+};
+
+template<typename TABLE>
+double run(size_t readerCount)
+{
+    TABLE table;
+    svec::SVector<Entry, CAPACITY> write;
+    write.resizeForOverwrite(CAPACITY);
+    std::fill(write.begin(), write.end(), Entry{0, 0});
+    table.store(write);
+
+    std::atomic<bool> start{false};
+    std::atomic<bool> stop{false};
+    std::atomic<uint64_t> totalLoads{0};
+
+    std::vector<std::thread> readers;
+    for (size_t r = 0; r < readerCount; r++)
+    {
+        readers.emplace_back([&]()
+        {
+            svec::SVector<Entry, CAPACITY> snapshot;
+            uint64_t loads = 0;
+            uint64_t checksum = 0;
+            while (!start.load(std::memory_order_acquire)) {}
+            while (!stop.load(std::memory_order_relaxed))
+            {
+                table.load(snapshot);
+                checksum += snapshot[0].value;
+                loads++;
+            }
+            totalLoads.fetch_add(loads + (checksum == 1), std::memory_order_relaxed);
+        });
+    }
+
+    start.store(true, std::memory_order_release);
+    Clock::time_point end = Clock::now() + DURATION;
+    for (uint64_t version = 0; Clock::now() < end; version++)
+    {
+        for (Entry& entry : write)
+        {
+            entry = {version, version};
+        }
+        table.store(write);
+        std::this_thread::sleep_for(WRITE_INTERVAL);
+    }
+    stop.store(true);
+    for (std::thread& reader : readers)
+    {
+        reader.join();
+    }
+    return totalLoads.load() / std::chrono::duration<double>(DURATION).count();
+}
+
+int main()
+{
+    size_t maxReaders = std::max(1u, std::thread::hardware_concurrency());
+    std::printf("%8s %20s %20s\n", "readers", "seqlock loads/s", "shared_mutex loads/s");
+    for (size_t readers = 1; readers <= maxReaders; readers *= 2)
+    {
+        double seqlock = run<svec::SSeqlockVector<Entry, CAPACITY>>(readers);
+        double sharedMutex = run<SharedMutexTable>(readers);
+        std::printf("%8zu %20.0f %20.0f\n", readers, seqlock, sharedMutex);
+    }
+    return 0;
+}
@@ -0,0 +1,110 @@
+// Copyright 2025 Dalton Prokosch
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <iterator>
+#include <memory>
+#include <random>
+#include <set>
+
+#include "sSetOperations.hpp"
+
+// Intersects, unites and subtracts pairs of sorted posting lists with the svec set operations and the std algorithms,
+// across selectivities (how many elements the lists share) and size skews. Reports ns per input element, the
+// output sizes have to match.
+
+using Clock = std::chrono::steady_clock;
+
+constexpr size_t CAPACITY = 1 << 16;
+constexpr size_t ROUNDS = 200;
+
+using List = svec::SVector<uint32_t, CAPACITY>;
+using Output = svec::SVector<uint32_t, 2 * CAPACITY>;
+
+/**
+ * @brief Fills list with size sorted distinct values below range
+ */
+void fill(List& list, std::mt19937& random, size_t size, uint32_t range)
+{
+    std::set<uint32_t> values;
+    while (values.size() < size)
+    {
+        values.insert(random() % range);
+    }
+    list.clear();
+    for (uint32_t value : values)
+    {
+        list.pushBack(value);
+    }
+}
+
+template<typename FUNCTION>
+void run(const char* name, size_t elements, FUNCTION&& function)
+{
+    size_t checksum = 0;
+    Clock::time_point start = Clock::now();
+    for (size_t round = 0; round < ROUNDS; round++)
+    {
+        checksum += function();
+    }
+    double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    std::printf("  %-22s %10.3f %12zu\n", name, seconds * 1e9 / (ROUNDS * elements), checksum / ROUNDS);
+}
+
+void compare(const char* label, size_t aSize, size_t bSize, uint32_t range)
+{
+    std::mt19937 random(aSize ^ bSize ^ range);
+    std::unique_ptr<List> a = std::make_unique<List>();
+    std::unique_ptr<List> b = std::make_unique<List>();
+    std::unique_ptr<Output> out = std::make_unique<Output>();
+    fill(*a, random, aSize, range);
+    fill(*b, random, bSize, range);
+    size_t elements = aSize + bSize;
+    const uint32_t* aBegin = a->data();
+    const uint32_t* aEnd = a->data() + a->size();
+    const uint32_t* bBegin = b->data();
+    const uint32_t* bEnd = b->data() + b->size();
+
+    std::printf("%s (%zu x %zu, range %u)\n", label, aSize, bSize, range);
+    run("svec::intersect", elements, [&]() { svec::intersect(*a, *b, *out); return out->size(); });
+    run("std::set_intersection", elements, [&]()
+    {
+        return static_cast<size_t>(std::set_intersection(aBegin, aEnd, bBegin, bEnd, out->data()) - out->data());
+    });
+    run("svec::intersectCount", elements, [&]() { return svec::intersectCount(*a, *b); });
+    run("svec::unite", elements, [&]() { svec::unite(*a, *b, *out); return out->size(); });
+    run("std::set_union", elements, [&]()
+    {
+        return static_cast<size_t>(std::set_union(aBegin, aEnd, bBegin, bEnd, out->data()) - out->data());
+    });
+    run("svec::difference", elements, [&]() { svec::difference(*a, *b, *out); return out->size(); });
+    run("std::set_difference", elements, [&]()
+    {
+        return static_cast<size_t>(std::set_difference(aBegin, aEnd, bBegin, bEnd, out->data()) - out->data());
+    });
+}
+
+int main()
+{
+    std::printf("  %-22s %10s %12s\n", "operation", "ns/elem", "output size");
+    compare("high selectivity", 50'000, 50'000, 60'000);
+    compare("medium selectivity", 50'000, 50'000, 500'000);
+    compare("low selectivity", 50'000, 50'000, 50'000'000);
+    compare("skewed 1:100", 500, 50'000, 500'000);
+    compare("skewed 1:1000", 50, 50'000, 500'000);
+    return 0;
+}
@@ -0,0 +1,113 @@
+// Copyright 2025 Dalton Prokosch
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+#include "sThreadPool.hpp"
+
+// Strong scaling of SThreadPool on two recursive fork-join workloads, from 1 thread up to every core:
+// fibonacci (tiny jobs, measures fork and steal overhead) and a divide and conquer sum (memory bound).
+
+using Clock = std::chrono::steady_clock;
+
+constexpr uint32_t FIBONACCI = 34;
+constexpr uint32_t FIBONACCI_CUTOFF = 16;
+constexpr size_t SUM_ELEMENTS = 1 << 25;
+constexpr size_t SUM_CUTOFF = 1 << 14;
+
+uint64_t fibonacciSequential(uint32_t n)
+{
+    return n < 2 ? n : fibonacciSequential(n - 1) + fibonacciSequential(n - 2);
+}
+
+uint64_t fibonacci(svec::SThreadPool& pool, uint32_t n)
+{
+    if (n < FIBONACCI_CUTOFF)
+    {
+        return fibonacciSequential(n);
+    }
+    uint64_t a = 0;
+    uint64_t b = 0;
+    pool.join([&]() { a = fibonacci(pool, n - 1); }, [&]() { b = fibonacci(pool, n - 2); });
+    return a + b;
+}
+
+uint64_t sum(svec::SThreadPool& pool, const uint32_t* values, size_t count)
+{
+    if (count <= SUM_CUTOFF)
+    {
+        uint64_t total = 0;
+        for (size_t i = 0; i < count; i++)
+        {
+            total += values[i];
+        }
+        return total;
+    }
+    uint64_t a = 0;
+    uint64_t b = 0;
+    size_t half = count / 2;
+    pool.join([&]() { a = sum(pool, values, half); }, [&]() { b = sum(pool, values + half, count - half); });
+    return a + b;
+}
+
+template<typename FUNCTION>
+double bestSeconds(const FUNCTION& function)
+{
+    double best = 1e9;
+    for (int repeat = 0; repeat < 5; repeat++)
+    {
+        Clock::time_point start = Clock::now();
+        function();
+        best = std::min(best, std::chrono::duration<double>(Clock::now() - start).count());
+    }
+    return best;
+}
+
+int main()
+{
+    std::vector<uint32_t> values(SUM_ELEMENTS);
+    for (size_t i = 0; i < values.size(); i++)
+    {
+        values[i] = static_cast<uint32_t>(i * 2654435761u);
+    }
+
+    size_t maxThreads = std::max(1u, std::thread::hardware_concurrency());
+    double fibonacciBase = 0;
+    double sumBase = 0;
+    std::printf("%8s %14s %10s %14s %10s\n", "threads", "fibonacci ms", "speedup", "sum ms", "speedup");
+    for (size_t threads = 1; threads <= maxThreads; threads *= 2)
+    {
+        svec::SThreadPool pool(threads - 1);
+        uint64_t checksum = 0;
+        double fibonacciSeconds = bestSeconds([&]() { checksum += fibonacci(pool, FIBONACCI); });
+        double sumSeconds = bestSeconds([&]() { checksum += sum(pool, values.data(), values.size()); });
+        if (threads == 1)
+        {
+            fibonacciBase = fibonacciSeconds;
+            sumBase = sumSeconds;
+        }
+        std::printf("%8zu %14.2f %10.2f %14.2f %10.2f   (checksum %llu)\n", threads, fibonacciSeconds * 1e3,
+            fibonacciBase / fibonacciSeconds, sumSeconds * 1e3, sumBase / sumSeconds, static_cast<unsigned long long>(checksum));
+        if (threads < maxThreads && threads * 2 > maxThreads)
+        {
+            threads = maxThreads / 2;
+        }
+    }
+    return 0;
+}
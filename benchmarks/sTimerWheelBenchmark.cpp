@@ -0,0 +1,117 @@
+// Copyright 2025 Dalton Prokosch
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <map>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "sTimerWheel.hpp"
+
+// Connection timeout workload: every operation schedules a timeout, most timeouts are cancelled before they fire
+// by the connection finishing, and time advances one tick every few operations. STimerWheel against std::multimap.
+
+using Clock = std::chrono::steady_clock;
+
+constexpr size_t OPERATIONS = 4'000'000;
+constexpr size_t LIVE = 50'000;
+constexpr uint64_t MAX_DELAY = 30'000;
+constexpr size_t OPERATIONS_PER_TICK = 8;
+
+using Wheel = svec::STimerWheel<uint64_t, 256, 3, 1024, 1 << 17>;
+
+struct Operation
+{
+    uint64_t delay;
+    bool cancel;
+};
+
+double runWheel(const std::vector<Operation>& operations, uint64_t& checksum)
+{
+    std::unique_ptr<Wheel> wheel = std::make_unique<Wheel>();
+    std::vector<svec::TimerHandle> handles(LIVE);
+    Clock::time_point start = Clock::now();
+    for (size_t i = 0; i < operations.size(); i++)
+    {
+        svec::TimerHandle& handle = handles[i % LIVE];
+        if (operations[i].cancel)
+        {
+            checksum += wheel->cancel(handle);
+        }
+        handle = wheel->schedule(operations[i].delay, i);
+        if (i % OPERATIONS_PER_TICK == 0)
+        {
+            for (uint64_t payload : wheel->tick())
+            {
+                checksum += payload;
+            }
+        }
+    }
+    return operations.size() / std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+double runMultimap(const std::vector<Operation>& operations, uint64_t& checksum)
+{
+    using Map = std::multimap<uint64_t, uint64_t>;
+    Map timers;
+    std::vector<Map::iterator> handles(LIVE, timers.end());
+    std::vector<bool> fired(operations.size(), false);
+    uint64_t now = 0;
+    Clock::time_point start = Clock::now();
+    for (size_t i = 0; i < operations.size(); i++)
+    {
+        size_t slot = i % LIVE;
+        if (operations[i].cancel && i >= LIVE && !fired[i - LIVE])
+        {
+            timers.erase(handles[slot]);
+            fired[i - LIVE] = true;
+            checksum++;
+        }
+        handles[slot] = timers.emplace(now + std::max<uint64_t>(operations[i].delay, 1), i);
+        if (i % OPERATIONS_PER_TICK == 0)
+        {
+            now++;
+            while (!timers.empty() && timers.begin()->first <= now)
+            {
+                checksum += timers.begin()->second;
+                fired[timers.begin()->second] = true;
+                timers.erase(timers.begin());
+            }
+        }
+    }
+    return operations.size() / std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+int main()
+{
+    std::mt19937_64 random(41);
+    std::vector<Operation> operations(OPERATIONS);
+    for (Operation& operation : operations)
+    {
+        operation.delay = random() % MAX_DELAY;
+        operation.cancel = random() % 10 != 0;
+    }
+
+    uint64_t wheelChecksum = 0;
+    uint64_t multimapChecksum = 0;
+    double wheel = runWheel(operations, wheelChecksum);
+    double multimap = runMultimap(operations, multimapChecksum);
+    std::printf("%-16s %22s %20s\n", "timers", "schedule+cancel ops/s", "checksum");
+    std::printf("%-16s %22.0f %20llu\n", "STimerWheel", wheel, static_cast<unsigned long long>(wheelChecksum));
+    std::printf("%-16s %22.0f %20llu\n", "std::multimap", multimap, static_cast<unsigned long long>(multimapChecksum));
+    return 0;
+}
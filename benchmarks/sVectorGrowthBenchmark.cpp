@@ -0,0 +1,91 @@
+// Copyright 2025 Dalton Prokosch
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "sVector.hpp"
+
+// Grows a std::vector of SVectors one push_back at a time, so every reallocation relocates all elements.
+// Legacy wraps SVector with the special members it had before they were noexcept and trivial: a move constructor
+// std::vector can not rely on (so it copies) and an element by element copy.
+
+using Clock = std::chrono::steady_clock;
+
+constexpr size_t ELEMENTS = 200'000;
+constexpr size_t ROUNDS = 5;
+
+template<typename T, size_t CAPACITY>
+struct Legacy : svec::SVector<T, CAPACITY>
+{
+    Legacy() = default;
+    Legacy(const Legacy& other) :
+        svec::SVector<T, CAPACITY>()
+    {
+        for (const T& element : other)
+        {
+            this->pushBack(element);
+        }
+    }
+    Legacy(Legacy&& other) noexcept(false) :
+        svec::SVector<T, CAPACITY>(std::move(other))
+    {}
+};
+
+template<typename VEC, typename FILL>
+void run(const char* name, FILL&& fill)
+{
+    size_t checksum = 0;
+    Clock::time_point start = Clock::now();
+    for (size_t round = 0; round < ROUNDS; round++)
+    {
+        std::vector<VEC> vectors;
+        for (size_t i = 0; i < ELEMENTS; i++)
+        {
+            fill(vectors.emplace_back(), i);
+        }
+        checksum += vectors.size() + vectors[ELEMENTS / 2].size();
+    }
+    double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    std::printf("%-34s %10.1f %12zu\n", name, seconds * 1e9 / (ROUNDS * ELEMENTS), checksum);
+}
+
+int main()
+{
+    auto fillInts = [](auto& vec, size_t i)
+    {
+        for (int j = 0; j < 6; j++)
+        {
+            vec.pushBack(static_cast<int>(i) + j);
+        }
+    };
+    auto fillStrings = [](auto& vec, size_t i)
+    {
+        for (int j = 0; j < 3; j++)
+        {
+            vec.pushBack(std::string(24, static_cast<char>('a' + (i + j) % 26)));
+        }
+    };
+
+    std::printf("%-34s %10s %12s\n", "element", "ns/push", "checksum");
+    run<svec::SVector<int, 8>>("SVector<int, 8>", fillInts);
+    run<Legacy<int, 8>>("SVector<int, 8> (legacy)", fillInts);
+    run<svec::SVector<int, 64>>("SVector<int, 64>", fillInts);
+    run<Legacy<int, 64>>("SVector<int, 64> (legacy)", fillInts);
+    run<svec::SVector<std::string, 4>>("SVector<std::string, 4>", fillStrings);
+    run<Legacy<std::string, 4>>("SVector<std::string, 4> (legacy)", fillStrings);
+    return 0;
+}
@@ -0,0 +1,142 @@
+// Copyright 2025 Dalton Prokosch
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <map>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+#include "sVector.hpp"
+
+// Uses small SVector tuples as keys of std::unordered_map and std::map, once with std::hash<SVector> and
+// operator<=> and once with the element by element hasher and comparator teams wrote by hand.
+// Reports ns per insert and per lookup, the checksums have to match.
+
+using Clock = std::chrono::steady_clock;
+using Tuple = svec::SVector<uint32_t, 8>;
+using Bytes = svec::SVector<uint8_t, 24>;
+
+constexpr size_t KEYS = 1'000'000;
+
+/**
+ * @brief hash_combine over std::hash of every element
+ */
+struct NaiveHash
+{
+    template<typename VEC>
+    size_t operator()(const VEC& vec) const
+    {
+        size_t hash = 0;
+        for (size_t i = 0; i < vec.size(); i++)
+        {
+            hash ^= std::hash<std::remove_cvref_t<decltype(vec[i])>>{}(vec[i]) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+        }
+        return hash;
+    }
+};
+
+/**
+ * @brief Element by element lexicographic less
+ */
+struct NaiveLess
+{
+    template<typename VEC>
+    bool operator()(const VEC& a, const VEC& b) const
+    {
+        for (size_t i = 0; i < a.size() && i < b.size(); i++)
+        {
+            if (a[i] != b[i])
+            {
+                return a[i] < b[i];
+            }
+        }
+        return a.size() < b.size();
+    }
+};
+
+template<typename MAP, typename KEY>
+void run(const char* name, const std::vector<KEY>& keys, const std::vector<KEY>& probes)
+{
+    MAP map;
+    Clock::time_point start = Clock::now();
+    for (size_t i = 0; i < keys.size(); i++)
+    {
+        map.emplace(keys[i], static_cast<uint32_t>(i));
+    }
+    double insertSeconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+    uint64_t checksum = 0;
+    start = Clock::now();
+    for (const KEY& probe : probes)
+    {
+        auto found = map.find(probe);
+        checksum += found != map.end() ? found->second : 1;
+    }
+    double lookupSeconds = std::chrono::duration<double>(Clock::now() - start).count();
+    std::printf("%-32s %10.1f %10.1f %16llu\n", name, insertSeconds * 1e9 / keys.size(),
+        lookupSeconds * 1e9 / probes.size(), static_cast<unsigned long long>(checksum));
+}
+
+template<typename HASH, typename KEY>
+void hashOnly(const char* name, const std::vector<KEY>& keys)
+{
+    uint64_t checksum = 0;
+    Clock::time_point start = Clock::now();
+    for (const KEY& key : keys)
+    {
+        checksum += HASH{}(key) & 0xFF;
+    }
+    double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    std::printf("%-32s %10s %10.1f %16llu\n", name, "-", seconds * 1e9 / keys.size(), static_cast<unsigned long long>(checksum));
+}
+
+int main()
+{
+    std::mt19937 random(5);
+    std::vector<Tuple> tuples(KEYS);
+    std::vector<Bytes> bytes(KEYS);
+    for (size_t i = 0; i < KEYS; i++)
+    {
+        // small field values, as in (shard, table, column, ...) tuples
+        size_t size = 3 + random() % 6;
+        for (size_t j = 0; j < size; j++)
+        {
+            tuples[i].pushBack(random() % 64);
+        }
+        for (size_t j = 0; j < 16 + random() % 8; j++)
+        {
+            bytes[i].pushBack(j < 12 ? 'a' + j : static_cast<uint8_t>(random()));
+        }
+    }
+    std::vector<Tuple> tupleProbes(tuples.rbegin(), tuples.rend());
+    std::vector<Bytes> byteProbes(bytes.rbegin(), bytes.rend());
+
+    std::printf("%-32s %10s %10s %16s\n", "container", "ns/insert", "ns/find", "checksum");
+    hashOnly<std::hash<Tuple>>("hash Tuple std::hash", tuples);
+    hashOnly<NaiveHash>("hash Tuple naive combine", tuples);
+    hashOnly<std::hash<Bytes>>("hash Bytes std::hash", bytes);
+    hashOnly<NaiveHash>("hash Bytes naive combine", bytes);
+    run<std::unordered_map<Tuple, uint32_t>>("unordered_map std::hash", tuples, tupleProbes);
+    run<std::unordered_map<Tuple, uint32_t, NaiveHash>>("unordered_map naive combine", tuples, tupleProbes);
+    run<std::map<Tuple, uint32_t>>("map<Tuple> operator<=>", tuples, tupleProbes);
+    run<std::map<Tuple, uint32_t, NaiveLess>>("map<Tuple> naive less", tuples, tupleProbes);
+    run<std::unordered_map<Bytes, uint32_t>>("unordered_map<Bytes> std::hash", bytes, byteProbes);
+    run<std::unordered_map<Bytes, uint32_t, NaiveHash>>("unordered_map<Bytes> naive", bytes, byteProbes);
+    run<std::map<Bytes, uint32_t>>("map<Bytes> operator<=> (memcmp)", bytes, byteProbes);
+    run<std::map<Bytes, uint32_t, NaiveLess>>("map<Bytes> naive less", bytes, byteProbes);
+    return 0;
+}
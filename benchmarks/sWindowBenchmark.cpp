@@ -0,0 +1,123 @@
+// Copyright 2025 Dalton Prokosch
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "sWindow.hpp"
+
+// Cost per sample of keeping min, max, mean and variance of the last N latency samples,
+// SWindow against rescanning the window on every sample, for windows from 16 to 65536.
+
+using Clock = std::chrono::steady_clock;
+
+constexpr size_t SAMPLES = 1 << 16;
+constexpr size_t SCAN_WORK = 1 << 25;
+
+struct Result
+{
+    double min;
+    double max;
+    double mean;
+    double variance;
+};
+
+template<size_t N>
+double windowNanoseconds(const std::vector<double>& samples, Result& result)
+{
+    using Window = svec::SWindow<double, N, svec::WindowMin, svec::WindowMax, svec::WindowVariance>;
+    std::unique_ptr<Window> window = std::make_unique<Window>();
+    Clock::time_point start = Clock::now();
+    for (double sample : samples)
+    {
+        window->push(sample);
+        result.min += window->template get<svec::WindowMin>().value();
+        result.max += window->template get<svec::WindowMax>().value();
+        result.mean += window->template get<svec::WindowVariance>().mean();
+        result.variance += window->template get<svec::WindowVariance>().value();
+    }
+    return std::chrono::duration<double, std::nano>(Clock::now() - start).count() / samples.size();
+}
+
+template<size_t N>
+double scanNanoseconds(const std::vector<double>& samples, Result& result)
+{
+    std::unique_ptr<svec::SVector<double, N>> ring = std::make_unique<svec::SVector<double, N>>();
+    size_t count = std::min(samples.size(), std::max<size_t>(N * 4, SCAN_WORK / N));
+    Clock::time_point start = Clock::now();
+    for (size_t i = 0; i < count; i++)
+    {
+        if (ring->size() < N)
+        {
+            ring->pushBack(samples[i]);
+        }
+        else
+        {
+            (*ring)[i % N] = samples[i];
+        }
+        auto [low, high] = std::minmax_element(ring->data(), ring->data() + ring->size());
+        double sum = 0;
+        for (double value : *ring)
+        {
+            sum += value;
+        }
+        double mean = sum / ring->size();
+        double squares = 0;
+        for (double value : *ring)
+        {
+            squares += (value - mean) * (value - mean);
+        }
+        result.min += *low;
+        result.max += *high;
+        result.mean += mean;
+        result.variance += squares / ring->size();
+    }
+    return std::chrono::duration<double, std::nano>(Clock::now() - start).count() / count;
+}
+
+template<size_t N>
+void compare(const std::vector<double>& samples)
+{
+    Result window{};
+    Result scan{};
+    double windowTime = windowNanoseconds<N>(samples, window);
+    double scanTime = scanNanoseconds<N>(samples, scan);
+    std::printf("%8zu %16.1f %16.1f %10.1fx   (checksum %.3g)\n", N, windowTime, scanTime, scanTime / windowTime,
+        window.min + window.max + window.mean + window.variance + scan.min + scan.max + scan.mean + scan.variance);
+}
+
+int main()
+{
+    std::mt19937_64 random(40);
+    std::lognormal_distribution<double> latency(3.0, 0.5);
+    std::vector<double> samples(SAMPLES);
+    for (double& sample : samples)
+    {
+        sample = latency(random);
+    }
+
+    std::printf("%8s %16s %16s %11s\n", "window", "SWindow ns/push", "scan ns/push", "speedup");
+    compare<16>(samples);
+    compare<64>(samples);
+    compare<256>(samples);
+    compare<1024>(samples);
+    compare<4096>(samples);
+    compare<16384>(samples);
+    compare<65536>(samples);
+    return 0;
+}
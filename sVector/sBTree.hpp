@@ -0,0 +1,906 @@
+// Copyright 2025 Dalton Prokosch
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SVEC_SBTREE
+#define SVEC_SBTREE
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include "sVector.hpp"
+
+namespace svec
+{
+
+/**
+ * @brief Key search kernels used by SBTree. Nodes are small and sorted, so instead of a binary search the kernels count
+ * how many keys are below the searched key, which compares 4 keys per instruction with SSE2 for 32 bit keys,
+ * auto-vectorizes for other arithmetic keys and falls back to a binary search for everything else.
+ * 
+ */
+namespace btreeSearch
+{
+
+/**
+ * @brief Counts keys less than key, which is the index of the first key not less than key
+ * 
+ * @tparam K
+ * @param keys sorted keys
+ * @param size
+ * @param key
+ * @return size_t
+ */
+template<typename K>
+inline size_t countLess(const K* keys, size_t size, const K& key)
+{
+    size_t i = 0;
+    size_t count = 0;
+#ifdef __SSE2__
+    if constexpr (std::is_same_v<K, int32_t> || std::is_same_v<K, uint32_t>)
+    {
+        // unsigned keys are compared as signed after flipping the sign bit
+        const __m128i flip = _mm_set1_epi32(std::is_same_v<K, uint32_t> ? INT32_MIN : 0);
+        const __m128i needle = _mm_xor_si128(_mm_set1_epi32(static_cast<int32_t>(key)), flip);
+        for (; i + 4 <= size; i += 4)
+        {
+            __m128i block = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(keys + i)), flip);
+            int mask = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmplt_epi32(block, needle)));
+            count += __builtin_popcount(mask);
+            if (mask != 0xF)
+            {
+                return count;
+            }
+        }
+    }
+#endif // __SSE2__ end
+    if constexpr (std::is_arithmetic_v<K>)
+    {
+        for (; i < size; i++)
+        {
+            count += keys[i] < key;
+        }
+        return count;
+    }
+    else
+    {
+        return std::lower_bound(keys, keys + size, key) - keys;
+    }
+}
+/**
+ * @brief Counts keys less than or equal to key, which is the index of the first key greater than key
+ * 
+ * @tparam K
+ * @param keys sorted keys
+ * @param size
+ * @param key
+ * @return size_t
+ */
+template<typename K>
+inline size_t countLessEqual(const K* keys, size_t size, const K& key)
+{
+    size_t i = 0;
+    size_t count = 0;
+#ifdef __SSE2__
+    if constexpr (std::is_same_v<K, int32_t> || std::is_same_v<K, uint32_t>)
+    {
+        const __m128i flip = _mm_set1_epi32(std::is_same_v<K, uint32_t> ? INT32_MIN : 0);
+        const __m128i needle = _mm_xor_si128(_mm_set1_epi32(static_cast<int32_t>(key)), flip);
+        for (; i + 4 <= size; i += 4)
+        {
+            __m128i block = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(keys + i)), flip);
+            int mask = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(block, needle)));
+            count += 4 - __builtin_popcount(mask);
+            if (mask != 0)
+            {
+                return count;
+            }
+        }
+    }
+#endif // __SSE2__ end
+    if constexpr (std::is_arithmetic_v<K>)
+    {
+        for (; i < size; i++)
+        {
+            count += !(key < keys[i]);
+        }
+        return count;
+    }
+    else
+    {
+        return std::upper_bound(keys, keys + size, key) - keys;
+    }
+}
+
+}
+
+/**
+ * @brief Ordered map stored as a B+tree whose nodes are fixed capacity SVectors a few cache lines wide.
+ * Inner nodes hold separator keys and 32 bit child indices, leaves hold keys and values in parallel SVectors and are
+ * linked left to right so range scans stream through leaves without walking back up the tree.
+ * Nodes are allocated from chunked pools, so indices and references stay valid while the tree grows.
+ * Erase removes the entry from its leaf without rebalancing, the tree keeps routing correctly and iteration
+ * skips leaves that became empty. Memory is given back by clear or bulkLoad.
+ * 
+ * @tparam K key type, ordered by operator<
+ * @tparam V value type
+ * @tparam NODE_CAPACITY max amount of keys per node, defaults to 4 cache lines of keys
+ */
+template<typename K, typename V, size_t NODE_CAPACITY = std::max<size_t>(16, 4 * CACHE_LINE_SIZE / sizeof(K))>
+class SBTree
+{
+    static_assert(NODE_CAPACITY >= 4, "SBTree requires a node capacity of at least 4");
+
+    /**
+     * @brief Index used for "no node"
+     * 
+     */
+    static constexpr uint32_t NONE = UINT32_MAX;
+    /**
+     * @brief Amount of nodes allocated at once by a pool
+     * 
+     */
+    static constexpr size_t NODES_PER_CHUNK = 256;
+
+    /**
+     * @brief Node above the leaves, child i holds keys in [keys[i - 1], keys[i])
+     * 
+     */
+    struct Inner
+    {
+        SVector<K, NODE_CAPACITY> keys;
+        SVector<uint32_t, NODE_CAPACITY + 1> children;
+
+        void clear()
+        {
+            keys.clear();
+            children.clear();
+        }
+    };
+    /**
+     * @brief Node holding entries, linked to the leaf on its right
+     * 
+     */
+    struct Leaf
+    {
+        SVector<K, NODE_CAPACITY> keys;
+        SVector<V, NODE_CAPACITY> values;
+        uint32_t next;
+
+        void clear()
+        {
+            keys.clear();
+            values.clear();
+            next = NONE;
+        }
+    };
+    /**
+     * @brief Key that has to be added to the parent after a node was split, and the new right node
+     * 
+     */
+    struct Split
+    {
+        K key;
+        uint32_t node;
+    };
+
+    /**
+     * @brief Hands out nodes by index from chunks that are never moved, so references survive allocations
+     * 
+     * @tparam NODE Inner or Leaf
+     */
+    template<typename NODE>
+    class NodePool
+    {
+    public:
+        /**
+         * @brief Returns index of an empty node, reusing chunks kept by reset
+         * 
+         * @return uint32_t
+         */
+        uint32_t allocate()
+        {
+            if (m_count == m_chunks.size() * NODES_PER_CHUNK)
+            {
+                m_chunks.push_back(std::make_unique<NODE[]>(NODES_PER_CHUNK));
+            }
+            uint32_t index = m_count++;
+            (*this)[index].clear();
+            return index;
+        }
+        /**
+         * @brief Marks every node free, chunks are kept for reuse
+         * 
+         */
+        void reset()
+        {
+            m_count = 0;
+        }
+        /**
+         * @brief Returns amount of allocated nodes
+         * 
+         * @return size_t
+         */
+        inline size_t size() const
+        {
+            return m_count;
+        }
+        /**
+         * @brief Accesses node
+         * 
+         * @param index
+         * @return NODE&
+         */
+        inline NODE& operator[](uint32_t index)
+        {
+            return m_chunks[index / NODES_PER_CHUNK][index % NODES_PER_CHUNK];
+        }
+        /**
+         * @brief Accesses node
+         * 
+         * @param index
+         * @return const NODE&
+         */
+        inline const NODE& operator[](uint32_t index) const
+        {
+            return m_chunks[index / NODES_PER_CHUNK][index % NODES_PER_CHUNK];
+        }
+
+    private:
+        /**
+         * @brief Fixed size arrays of nodes
+         * 
+         */
+        std::vector<std::unique_ptr<NODE[]>> m_chunks;
+        /**
+         * @brief Amount of nodes handed out
+         * 
+         */
+        uint32_t m_count = 0;
+    };
+
+public:
+    /**
+     * @brief Forward iterator over entries in key order
+     * 
+     * @tparam VALUE V or const V
+     * @tparam TREE SBTree or const SBTree
+     */
+    template<typename VALUE, typename TREE>
+    class BasicIterator
+    {
+    public:
+        /**
+         * @brief Construct a new BasicIterator object, moves past empty leaves so it points at an entry or is end
+         * 
+         * @param tree
+         * @param leaf
+         * @param position
+         */
+        BasicIterator(TREE* tree, uint32_t leaf, size_t position) :
+            m_tree(tree),
+            m_leaf(leaf),
+            m_position(position)
+        {
+            skipExhausted();
+        }
+        /**
+         * @brief Moves to next entry
+         * 
+         * @return BasicIterator&
+         */
+        BasicIterator& operator++()
+        {
+            m_position++;
+            skipExhausted();
+            return *this;
+        }
+        /**
+         * @brief Moves to next entry
+         * 
+         * @return BasicIterator
+         */
+        BasicIterator operator++(int)
+        {
+            BasicIterator iterator = *this;
+            ++(*this);
+            return iterator;
+        }
+        /**
+         * @brief Accesses key and value
+         * 
+         * @return std::pair<const K&, VALUE&>
+         */
+        std::pair<const K&, VALUE&> operator*() const
+        {
+            return {key(), value()};
+        }
+        /**
+         * @brief Accesses key
+         * 
+         * @return const K&
+         */
+        const K& key() const
+        {
+            return m_tree->m_leaves[m_leaf].keys.data()[m_position];
+        }
+        /**
+         * @brief Accesses value
+         * 
+         * @return VALUE&
+         */
+        VALUE& value() const
+        {
+            return m_tree->m_leaves[m_leaf].values.data()[m_position];
+        }
+        /**
+         * @brief Checks if both iterators point at the same entry
+         * 
+         * @param other
+         * @return bool
+         */
+        bool operator==(const BasicIterator& other) const
+        {
+            return m_leaf == other.m_leaf && m_position == other.m_position;
+        }
+
+    private:
+        /**
+         * @brief Follows leaf links while the position is past the end of its leaf
+         * 
+         */
+        void skipExhausted()
+        {
+            while (m_leaf != NONE && m_position >= m_tree->m_leaves[m_leaf].keys.size())
+            {
+                m_leaf = m_tree->m_leaves[m_leaf].next;
+                m_position = 0;
+            }
+        }
+
+        TREE* m_tree;
+        uint32_t m_leaf;
+        size_t m_position;
+    };
+    using Iterator = BasicIterator<V, SBTree>;
+    using ConstIterator = BasicIterator<const V, const SBTree>;
+
+    /**
+     * @brief Half open range of entries returned by range()
+     * 
+     * @tparam ITERATOR
+     */
+    template<typename ITERATOR>
+    struct Range
+    {
+        ITERATOR first;
+        ITERATOR last;
+
+        ITERATOR begin() const
+        {
+            return first;
+        }
+        ITERATOR end() const
+        {
+            return last;
+        }
+    };
+
+    /**
+     * @brief Construct a new empty SBTree object
+     * 
+     */
+    SBTree()
+    {
+        clear();
+    }
+
+    /**
+     * @brief Adds entry if key is not present
+     * 
+     * @param key
+     * @param value
+     * @return true entry was added
+     * @return false key was already present, its value is unchanged
+     */
+    inline bool insert(const K& key, const V& value)
+    {
+        return insertEntry<false>(key, value);
+    }
+    /**
+     * @brief Adds entry or replaces the value of an existing key
+     * 
+     * @param key
+     * @param value
+     * @return true entry was added
+     * @return false key was already present and its value was replaced
+     */
+    inline bool insertOrAssign(const K& key, const V& value)
+    {
+        return insertEntry<true>(key, value);
+    }
+    /**
+     * @brief Removes entry with key from its leaf, nodes are not merged
+     * 
+     * @param key
+     * @return true entry was removed
+     * @return false key was not present
+     */
+    bool erase(const K& key)
+    {
+        Leaf& leaf = m_leaves[findLeaf(key)];
+        size_t position = btreeSearch::countLess(leaf.keys.data(), leaf.keys.size(), key);
+        if (position == leaf.keys.size() || key < leaf.keys.data()[position])
+        {
+            return false;
+        }
+        leaf.keys.erase(position);
+        leaf.values.erase(position);
+        m_size--;
+        return true;
+    }
+
+    /**
+     * @brief Finds value of key
+     * 
+     * @param key
+     * @return V* value or nullptr when key is not present
+     */
+    inline V* find(const K& key)
+    {
+        return const_cast<V*>(std::as_const(*this).find(key));
+    }
+    /**
+     * @brief Finds value of key
+     * 
+     * @param key
+     * @return const V* value or nullptr when key is not present
+     */
+    inline const V* find(const K& key) const
+    {
+        const Leaf& leaf = m_leaves[findLeaf(key)];
+        size_t position = btreeSearch::countLess(leaf.keys.data(), leaf.keys.size(), key);
+        if (position == leaf.keys.size() || key < leaf.keys.data()[position])
+        {
+            return nullptr;
+        }
+        return leaf.values.data() + position;
+    }
+    /**
+     * @brief Checks if key is present
+     * 
+     * @param key
+     * @return true
+     * @return false
+     */
+    inline bool contains(const K& key) const
+    {
+        return find(key) != nullptr;
+    }
+    /**
+     * @brief Returns iterator to first entry whose key is not less than key
+     * 
+     * @param key
+     * @return Iterator
+     */
+    inline Iterator lowerBound(const K& key)
+    {
+        uint32_t leaf = findLeaf(key);
+        return Iterator(this, leaf, btreeSearch::countLess(m_leaves[leaf].keys.data(), m_leaves[leaf].keys.size(), key));
+    }
+    /**
+     * @brief Returns iterator to first entry whose key is not less than key
+     * 
+     * @param key
+     * @return ConstIterator
+     */
+    inline ConstIterator lowerBound(const K& key) const
+    {
+        uint32_t leaf = findLeaf(key);
+        return ConstIterator(this, leaf, btreeSearch::countLess(m_leaves[leaf].keys.data(), m_leaves[leaf].keys.size(), key));
+    }
+    /**
+     * @brief Returns entries whose keys are in [low, high)
+     * 
+     * @param low
+     * @param high
+     * @return Range<Iterator>
+     */
+    inline Range<Iterator> range(const K& low, const K& high)
+    {
+        return {lowerBound(low), lowerBound(high)};
+    }
+    /**
+     * @brief Returns entries whose keys are in [low, high)
+     * 
+     * @param low
+     * @param high
+     * @return Range<ConstIterator>
+     */
+    inline Range<ConstIterator> range(const K& low, const K& high) const
+    {
+        return {lowerBound(low), lowerBound(high)};
+    }
+    /**
+     * @brief Returns iterator to entry with the smallest key
+     * 
+     * @return Iterator
+     */
+    inline Iterator begin()
+    {
+        return Iterator(this, m_first, 0);
+    }
+    /**
+     * @brief Returns iterator to entry with the smallest key
+     * 
+     * @return ConstIterator
+     */
+    inline ConstIterator begin() const
+    {
+        return ConstIterator(this, m_first, 0);
+    }
+    /**
+     * @brief Returns iterator past the entry with the largest key
+     * 
+     * @return Iterator
+     */
+    inline Iterator end()
+    {
+        return Iterator(this, NONE, 0);
+    }
+    /**
+     * @brief Returns iterator past the entry with the largest key
+     * 
+     * @return ConstIterator
+     */
+    inline ConstIterator end() const
+    {
+        return ConstIterator(this, NONE, 0);
+    }
+
+    /**
+     * @brief Replaces contents with entries sorted by strictly increasing key, building every level bottom up
+     * in O(n) instead of inserting one by one.
+     * 
+     * @param sorted entries sorted by key without duplicates
+     * @param leafFill amount of entries per leaf, less than NODE_CAPACITY leaves room for later inserts without splits
+     */
+    void bulkLoad(std::span<const std::pair<K, V>> sorted, size_t leafFill = NODE_CAPACITY)
+    {
+        leafFill = std::clamp<size_t>(leafFill, 1, NODE_CAPACITY);
+    #ifdef _DEBUG
+        for (size_t i = 1; i < sorted.size(); i++)
+        {
+            if (!(sorted[i - 1].first < sorted[i].first))
+            {
+                throw std::invalid_argument("ERROR: bulk load input is not strictly increasing at index " + std::to_string(i));
+            }
+        }
+    #endif // _DEBUG end
+        m_inners.reset();
+        m_leaves.reset();
+        m_size = sorted.size();
+        m_height = 0;
+        if (sorted.empty())
+        {
+            m_root = m_first = m_leaves.allocate();
+            return;
+        }
+
+        std::vector<uint32_t> level;
+        std::vector<K> lowest;
+        size_t leafCount = (sorted.size() + leafFill - 1) / leafFill;
+        size_t offset = 0;
+        for (size_t i = 0; i < leafCount; i++)
+        {
+            size_t count = sorted.size() / leafCount + (i < sorted.size() % leafCount);
+            uint32_t index = m_leaves.allocate();
+            Leaf& leaf = m_leaves[index];
+            for (size_t j = offset; j < offset + count; j++)
+            {
+                leaf.keys.uncheckedPushBack(sorted[j].first);
+                leaf.values.uncheckedPushBack(sorted[j].second);
+            }
+            if (!level.empty())
+            {
+                m_leaves[level.back()].next = index;
+            }
+            level.push_back(index);
+            lowest.push_back(sorted[offset].first);
+            offset += count;
+        }
+        m_first = level.front();
+
+        while (level.size() > 1)
+        {
+            std::vector<uint32_t> parents;
+            std::vector<K> parentLowest;
+            size_t parentCount = (level.size() + NODE_CAPACITY) / (NODE_CAPACITY + 1);
+            offset = 0;
+            for (size_t i = 0; i < parentCount; i++)
+            {
+                size_t count = level.size() / parentCount + (i < level.size() % parentCount);
+                uint32_t index = m_inners.allocate();
+                Inner& inner = m_inners[index];
+                for (size_t j = offset; j < offset + count; j++)
+                {
+                    if (j != offset)
+                    {
+                        inner.keys.uncheckedPushBack(lowest[j]);
+                    }
+                    inner.children.uncheckedPushBack(level[j]);
+                }
+                parents.push_back(index);
+                parentLowest.push_back(lowest[offset]);
+                offset += count;
+            }
+            level = std::move(parents);
+            lowest = std::move(parentLowest);
+            m_height++;
+        }
+        m_root = level.front();
+    }
+    /**
+     * @brief Removes every entry, node chunks are kept for reuse
+     * 
+     */
+    void clear()
+    {
+        m_inners.reset();
+        m_leaves.reset();
+        m_root = m_first = m_leaves.allocate();
+        m_height = 0;
+        m_size = 0;
+    }
+
+    /**
+     * @brief Returns amount of entries
+     * 
+     * @return size_t
+     */
+    inline size_t size() const
+    {
+        return m_size;
+    }
+    /**
+     * @brief Checks if there are no entries
+     * 
+     * @return true
+     * @return false
+     */
+    inline bool empty() const
+    {
+        return m_size == 0;
+    }
+    /**
+     * @brief Returns amount of levels including the leaves
+     * 
+     * @return size_t
+     */
+    inline size_t height() const
+    {
+        return m_height + 1;
+    }
+    /**
+     * @brief Returns amount of inner and leaf nodes in use
+     * 
+     * @return size_t
+     */
+    inline size_t nodes() const
+    {
+        return m_inners.size() + m_leaves.size();
+    }
+
+private:
+    /**
+     * @brief Walks inner levels down to the leaf that holds or would hold key
+     * 
+     * @param key
+     * @return uint32_t
+     */
+    inline uint32_t findLeaf(const K& key) const
+    {
+        uint32_t node = m_root;
+        for (size_t level = m_height; level > 0; level--)
+        {
+            const Inner& inner = m_inners[node];
+            node = inner.children.data()[btreeSearch::countLessEqual(inner.keys.data(), inner.keys.size(), key)];
+        }
+        return node;
+    }
+    /**
+     * @brief Inserts entry below root and grows a new root when the old one was split
+     * 
+     * @tparam ASSIGN replace value of an existing key
+     * @param key
+     * @param value
+     * @return true entry was added
+     * @return false key was already present
+     */
+    template<bool ASSIGN>
+    bool insertEntry(const K& key, const V& value)
+    {
+        bool added = false;
+        std::optional<Split> split = insertInto<ASSIGN>(m_root, m_height, key, value, added);
+        if (split)
+        {
+            uint32_t root = m_inners.allocate();
+            Inner& inner = m_inners[root];
+            inner.keys.uncheckedPushBack(std::move(split->key));
+            inner.children.uncheckedPushBack(m_root);
+            inner.children.uncheckedPushBack(split->node);
+            m_root = root;
+            m_height++;
+        }
+        m_size += added;
+        return added;
+    }
+    /**
+     * @brief Inserts entry into subtree of node, splitting full nodes on the way back up
+     * 
+     * @tparam ASSIGN replace value of an existing key
+     * @param node
+     * @param level 0 for leaves
+     * @param key
+     * @param value
+     * @param added set when a new entry was added
+     * @return std::optional<Split> separator and right node when node was split
+     */
+    template<bool ASSIGN>
+    std::optional<Split> insertInto(uint32_t node, size_t level, const K& key, const V& value, bool& added)
+    {
+        if (level == 0)
+        {
+            return insertIntoLeaf<ASSIGN>(node, key, value, added);
+        }
+        Inner& inner = m_inners[node];
+        size_t slot = btreeSearch::countLessEqual(inner.keys.data(), inner.keys.size(), key);
+        std::optional<Split> split = insertInto<ASSIGN>(inner.children.data()[slot], level - 1, key, value, added);
+        if (!split)
+        {
+            return std::nullopt;
+        }
+        if (inner.keys.size() < NODE_CAPACITY)
+        {
+            inner.keys.insert(slot, std::move(split->key));
+            inner.children.insert(slot + 1, split->node);
+            return std::nullopt;
+        }
+
+        // the full node plus the new separator is split around its middle key, which moves up to the parent
+        SVector<K, NODE_CAPACITY + 1> keys;
+        SVector<uint32_t, NODE_CAPACITY + 2> children;
+        moveInto(keys, inner.keys.data(), NODE_CAPACITY);
+        moveInto(children, inner.children.data(), NODE_CAPACITY + 1);
+        keys.insert(slot, std::move(split->key));
+        children.insert(slot + 1, split->node);
+
+        size_t middle = (NODE_CAPACITY + 1) / 2;
+        uint32_t rightIndex = m_inners.allocate();
+        Inner& right = m_inners[rightIndex];
+        moveInto(inner.keys, keys.data(), middle);
+        moveInto(inner.children, children.data(), middle + 1);
+        moveInto(right.keys, keys.data() + middle + 1, NODE_CAPACITY - middle);
+        moveInto(right.children, children.data() + middle + 1, NODE_CAPACITY + 1 - middle);
+        return Split{std::move(keys[middle]), rightIndex};
+    }
+    /**
+     * @brief Inserts entry into leaf, splitting it when full. Appending to the rightmost leaf moves only the new entry
+     * into the new leaf so ascending inserts leave full leaves behind.
+     * 
+     * @tparam ASSIGN replace value of an existing key
+     * @param node
+     * @param key
+     * @param value
+     * @param added set when a new entry was added
+     * @return std::optional<Split> first key of and index of the new right leaf when leaf was split
+     */
+    template<bool ASSIGN>
+    std::optional<Split> insertIntoLeaf(uint32_t node, const K& key, const V& value, bool& added)
+    {
+        Leaf& leaf = m_leaves[node];
+        size_t position = btreeSearch::countLess(leaf.keys.data(), leaf.keys.size(), key);
+        if (position < leaf.keys.size() && !(key < leaf.keys.data()[position]))
+        {
+            if constexpr (ASSIGN)
+            {
+                leaf.values.data()[position] = value;
+            }
+            return std::nullopt;
+        }
+        added = true;
+        if (leaf.keys.size() < NODE_CAPACITY)
+        {
+            leaf.keys.insert(position, key);
+            leaf.values.insert(position, value);
+            return std::nullopt;
+        }
+
+        size_t middle = (position == NODE_CAPACITY && leaf.next == NONE) ? NODE_CAPACITY : NODE_CAPACITY / 2;
+        uint32_t rightIndex = m_leaves.allocate();
+        Leaf& right = m_leaves[rightIndex];
+        moveInto(right.keys, leaf.keys.data() + middle, NODE_CAPACITY - middle);
+        moveInto(right.values, leaf.values.data() + middle, NODE_CAPACITY - middle);
+        leaf.keys.resizeForOverwrite(middle);
+        leaf.values.resizeForOverwrite(middle);
+        right.next = leaf.next;
+        leaf.next = rightIndex;
+        Leaf& target = position < middle ? leaf : right;
+        size_t targetPosition = position < middle ? position : position - middle;
+        target.keys.insert(targetPosition, key);
+        target.values.insert(targetPosition, value);
+        return Split{right.keys.front(), rightIndex};
+    }
+
+    /**
+     * @brief Replaces contents of destination with count elements moved from source
+     * 
+     * @tparam T
+     * @tparam C
+     * @param destination
+     * @param source
+     * @param count
+     */
+    template<typename T, size_t C>
+    static inline void moveInto(SVector<T, C>& destination, T* source, size_t count)
+    {
+        destination.clear();
+        for (size_t i = 0; i < count; i++)
+        {
+            destination.uncheckedEmplaceBack(std::move(source[i]));
+        }
+    }
+
+    /**
+     * @brief Inner nodes
+     * 
+     */
+    NodePool<Inner> m_inners;
+    /**
+     * @brief Leaf nodes
+     * 
+     */
+    NodePool<Leaf> m_leaves;
+    /**
+     * @brief Root node, a leaf while m_height is 0
+     * 
+     */
+    uint32_t m_root;
+    /**
+     * @brief Leftmost leaf
+     * 
+     */
+    uint32_t m_first;
+    /**
+     * @brief Amount of inner levels
+     * 
+     */
+    size_t m_height;
+    /**
+     * @brief Amount of entries
+     * 
+     */
+    size_t m_size;
+};
+
+}
+
+#endif // SVEC_SBTREE END
@@ -0,0 +1,295 @@
+// Copyright 2025 Dalton Prokosch
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SVEC_SBATCHER
+#define SVEC_SBATCHER
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <span>
+#include <thread>
+
+#include "sVector.hpp"
+
+namespace svec
+{
+
+/**
+ * @brief Accumulates elements on the stack and hands them to a sink as a std::span<T> once the batch reaches
+ * a size threshold, once its oldest element is older than a delay, or when flush is called.
+ * When BACKGROUND is true two batches are kept and a background thread runs the sink on one while the producer fills the other,
+ * the producer only blocks if it fills a batch before the previous one was drained.
+ * Elements are pushed from a single producer thread.
+ * 
+ * @tparam T type stored in batches
+ * @tparam CAPACITY max size of a batch
+ * @tparam SINK callable taking std::span<T>
+ * @tparam BACKGROUND run sink on a background thread
+ */
+template<typename T, size_t CAPACITY, typename SINK, bool BACKGROUND = false>
+class SBatcher
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @brief Construct a new SBatcher object, starts background thread when BACKGROUND is true
+     * 
+     * @param sink called with every full batch
+     * @param sizeThreshold batch is flushed once it holds this many elements
+     * @param maxDelay batch is flushed once its oldest element is older than this, checked on push and poll
+     */
+    SBatcher(SINK sink, size_t sizeThreshold = CAPACITY, Clock::duration maxDelay = Clock::duration::max()) :
+        m_sink(std::move(sink)),
+        m_sizeThreshold{std::min(sizeThreshold, CAPACITY)},
+        m_maxDelay{maxDelay}
+    {
+        if constexpr (BACKGROUND)
+        {
+            m_worker = std::thread([this]() { drainLoop(); });
+        }
+    }
+    SBatcher(const SBatcher&) = delete;
+    SBatcher& operator=(const SBatcher&) = delete;
+    /**
+     * @brief Flushes remaining elements, waits for them to be drained and stops background thread
+     * 
+     */
+    ~SBatcher()
+    {
+        flush();
+        if constexpr (BACKGROUND)
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_stop = true;
+            }
+            m_condition.notify_all();
+            m_worker.join();
+        }
+    }
+
+    /**
+     * @brief Adds element to batch, flushes if a threshold was hit
+     * 
+     * @param element
+     */
+    inline void push(const T& element)
+    {
+        emplace(element);
+    }
+    /**
+     * @brief Adds element to batch, flushes if a threshold was hit
+     * 
+     * @param element
+     */
+    inline void push(T&& element)
+    {
+        emplace(std::move(element));
+    }
+    /**
+     * @brief Emplaces element in batch, flushes if a threshold was hit
+     * 
+     * @tparam ARGS
+     * @param args
+     */
+    template<typename... ARGS>
+    inline void emplace(ARGS&&... args)
+    {
+        SVector<T, CAPACITY>& batch = m_batches[m_active];
+        if (hasDelay() && batch.size() == 0)
+        {
+            m_oldest = Clock::now();
+        }
+        batch.emplaceBack(std::forward<ARGS>(args)...);
+        if (batch.size() >= m_sizeThreshold || (hasDelay() && Clock::now() - m_oldest >= m_maxDelay))
+        {
+            flush();
+        }
+    }
+    /**
+     * @brief Flushes batch if its oldest element is older than the delay, for producers that go idle
+     * 
+     * @return true batch was flushed
+     * @return false
+     */
+    inline bool poll()
+    {
+        if (!hasDelay() || m_batches[m_active].size() == 0 || Clock::now() - m_oldest < m_maxDelay)
+        {
+            return false;
+        }
+        flush();
+        return true;
+    }
+    /**
+     * @brief Hands current batch to sink. With BACKGROUND this returns once the batch was handed to the background thread.
+     * 
+     */
+    void flush()
+    {
+        SVector<T, CAPACITY>& batch = m_batches[m_active];
+        if (batch.size() == 0)
+        {
+            return;
+        }
+        if constexpr (BACKGROUND)
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_condition.wait(lock, [this]() { return !m_pending; });
+            m_pending = true;
+            m_draining = m_active;
+            m_active ^= 1;
+            lock.unlock();
+            m_condition.notify_all();
+        }
+        else
+        {
+            m_sink(std::span<T>(batch.data(), batch.size()));
+            batch.clear();
+        }
+    }
+    /**
+     * @brief Blocks until the background thread has drained every handed off batch. Does not flush current batch.
+     * 
+     */
+    void wait()
+    {
+        if constexpr (BACKGROUND)
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_condition.wait(lock, [this]() { return !m_pending; });
+        }
+    }
+    /**
+     * @brief Returns amount of elements in current batch
+     * 
+     * @return size_t
+     */
+    inline size_t size() const
+    {
+        return m_batches[m_active].size();
+    }
+    /**
+     * @brief Returns max size of a batch
+     * 
+     * @return size_t
+     */
+    inline size_t capacity() const
+    {
+        return CAPACITY;
+    }
+
+private:
+    /**
+     * @brief Checks if a time threshold was given
+     * 
+     * @return true
+     * @return false
+     */
+    inline bool hasDelay() const
+    {
+        return m_maxDelay != Clock::duration::max();
+    }
+    /**
+     * @brief Background thread, runs sink on every handed off batch until stopped
+     * 
+     */
+    void drainLoop()
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        while (true)
+        {
+            m_condition.wait(lock, [this]() { return m_pending || m_stop; });
+            if (!m_pending)
+            {
+                return;
+            }
+            SVector<T, CAPACITY>& batch = m_batches[m_draining];
+            lock.unlock();
+            m_sink(std::span<T>(batch.data(), batch.size()));
+            batch.clear();
+            lock.lock();
+            m_pending = false;
+            m_condition.notify_all();
+        }
+    }
+
+    /**
+     * @brief Batch being filled and, with BACKGROUND, batch being drained
+     * 
+     */
+    SVector<T, CAPACITY> m_batches[BACKGROUND ? 2 : 1];
+    /**
+     * @brief Index of batch being filled
+     * 
+     */
+    size_t m_active = 0;
+    /**
+     * @brief Called with every batch
+     * 
+     */
+    SINK m_sink;
+    /**
+     * @brief Batch is flushed once it holds this many elements
+     * 
+     */
+    size_t m_sizeThreshold;
+    /**
+     * @brief Batch is flushed once its oldest element is older than this
+     * 
+     */
+    Clock::duration m_maxDelay;
+    /**
+     * @brief When oldest element of current batch was added
+     * 
+     */
+    Clock::time_point m_oldest;
+
+    /**
+     * @brief Guards m_pending, m_draining and m_stop
+     * 
+     */
+    std::mutex m_mutex;
+    /**
+     * @brief Signals hand offs, drains and stopping
+     * 
+     */
+    std::condition_variable m_condition;
+    /**
+     * @brief Background thread running sink
+     * 
+     */
+    std::thread m_worker;
+    /**
+     * @brief Index of batch handed to background thread
+     * 
+     */
+    size_t m_draining = 0;
+    /**
+     * @brief A batch was handed off and has not been drained yet
+     * 
+     */
+    bool m_pending = false;
+    /**
+     * @brief Background thread should exit once nothing is pending
+     * 
+     */
+    bool m_stop = false;
+};
+
+}
+
+#endif // SVEC_SBATCHER END
@@ -0,0 +1,252 @@
+// Copyright 2025 Dalton Prokosch
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SVEC_SCONCURRENT_APPEND_VECTOR
+#define SVEC_SCONCURRENT_APPEND_VECTOR
+
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <span>
+#include <thread>
+
+#include "sVector.hpp"
+
+namespace svec
+{
+
+/**
+ * @brief Fixed capacity vector many threads can append to without a lock.
+ * A writer reserves a slot with one fetch_add, constructs its element in place and marks the slot ready.
+ * The published watermark is then moved over every ready slot, so readers can iterate the published prefix
+ * while writers are still appending. Once every writer is done seal() moves the elements into a normal SVector.
+ * 
+ * @tparam T type stored in container
+ * @tparam CAPACITY size allocated on stack
+ */
+template<typename T, size_t CAPACITY>
+class SConcurrentAppendVector
+{
+public:
+    /**
+     * @brief Construct a new empty SConcurrentAppendVector object
+     * 
+     */
+    SConcurrentAppendVector()
+    {
+        for (std::atomic<bool>& ready : m_ready)
+        {
+            ready.store(false, std::memory_order_relaxed);
+        }
+    }
+    SConcurrentAppendVector(const SConcurrentAppendVector&) = delete;
+    SConcurrentAppendVector& operator=(const SConcurrentAppendVector&) = delete;
+    /**
+     * @brief Destroys elements, every writer has to be done
+     * 
+     */
+    ~SConcurrentAppendVector()
+    {
+        seal();
+    }
+
+    /**
+     * @brief Adds element, safe to call from many threads
+     * 
+     * @param element
+     * @return true element was added
+     * @return false container was full
+     */
+    inline bool pushBack(const T& element)
+    {
+        return emplaceBack(element);
+    }
+    /**
+     * @brief Adds element, safe to call from many threads
+     * 
+     * @param element
+     * @return true element was added
+     * @return false container was full
+     */
+    inline bool pushBack(T&& element)
+    {
+        return emplaceBack(std::move(element));
+    }
+    /**
+     * @brief Constructs element in its reserved slot, safe to call from many threads
+     * 
+     * @tparam ARGS
+     * @param args
+     * @return true element was added
+     * @return false container was full
+     */
+    template<typename... ARGS>
+    inline bool emplaceBack(ARGS&&... args)
+    {
+        size_t slot = m_reserved.fetch_add(1, std::memory_order_relaxed);
+        if (slot >= CAPACITY)
+        {
+            return false;
+        }
+        std::construct_at(slots() + slot, std::forward<ARGS>(args)...);
+        m_ready[slot].store(true, std::memory_order_seq_cst);
+        publish();
+        return true;
+    }
+
+    /**
+     * @brief Returns amount of published elements, every element below this index is readable
+     * 
+     * @return size_t
+     */
+    inline size_t size() const
+    {
+        return m_published.load(std::memory_order_acquire);
+    }
+    /**
+     * @brief Returns size of array
+     * 
+     * @return size_t
+     */
+    inline size_t capacity() const
+    {
+        return CAPACITY;
+    }
+    /**
+     * @brief Accesses published element
+     * 
+     * @param i index less than size()
+     * @return const T&
+     */
+    inline const T& operator[](size_t i) const
+    {
+        return slots()[i];
+    }
+    /**
+     * @brief Returns elements published so far, safe to read while writers are appending
+     * 
+     * @return std::span<const T>
+     */
+    inline std::span<const T> published() const
+    {
+        return std::span<const T>(slots(), size());
+    }
+
+    /**
+     * @brief Waits for every reserved slot to be published and moves elements over into a SVector.
+     * No element may be added after sealing.
+     * 
+     * @return const SVector<T, CAPACITY>&
+     */
+    const SVector<T, CAPACITY>& seal()
+    {
+        if (m_isSealed)
+        {
+            return m_sealed;
+        }
+        size_t count = std::min(m_reserved.load(std::memory_order_acquire), CAPACITY);
+        while (m_published.load(std::memory_order_acquire) < count)
+        {
+            publish();
+            std::this_thread::yield();
+        }
+        T* elements = slots();
+        if constexpr (std::is_trivially_copyable_v<T>)
+        {
+            m_sealed.resizeForOverwrite(count);
+            memcpy(m_sealed.data(), elements, count * sizeof(T));
+        }
+        else
+        {
+            for (size_t i = 0; i < count; i++)
+            {
+                m_sealed.uncheckedPushBack(std::move(elements[i]));
+            }
+            std::destroy(elements, elements + count);
+        }
+        m_isSealed = true;
+        return m_sealed;
+    }
+
+private:
+    /**
+     * @brief Returns slot storage as elements
+     * 
+     * @return T*
+     */
+    inline T* slots()
+    {
+        return std::launder(reinterpret_cast<T*>(m_storage));
+    }
+    /**
+     * @brief Returns slot storage as elements
+     * 
+     * @return const T*
+     */
+    inline const T* slots() const
+    {
+        return std::launder(reinterpret_cast<const T*>(m_storage));
+    }
+    /**
+     * @brief Moves published watermark over every ready slot. Any writer can finish the work of a slower one.
+     * Ready flags are sequentially consistent so two writers finishing neighbouring slots can not both miss each other's flag.
+     * 
+     */
+    inline void publish()
+    {
+        size_t published = m_published.load(std::memory_order_acquire);
+        while (published < CAPACITY && m_ready[published].load(std::memory_order_seq_cst))
+        {
+            if (m_published.compare_exchange_weak(published, published + 1, std::memory_order_acq_rel, std::memory_order_acquire))
+            {
+                published++;
+            }
+        }
+    }
+
+    /**
+     * @brief Slots writers construct elements in, moved into m_sealed by seal()
+     * 
+     */
+    alignas(T) std::byte m_storage[CAPACITY * sizeof(T)];
+    /**
+     * @brief Elements handed out by seal()
+     * 
+     */
+    SVector<T, CAPACITY> m_sealed;
+    /**
+     * @brief Whether elements were moved into m_sealed
+     * 
+     */
+    bool m_isSealed = false;
+    /**
+     * @brief Whether the slot at each index has been constructed
+     * 
+     */
+    std::atomic<bool> m_ready[CAPACITY];
+    /**
+     * @brief Amount of slots handed out to writers, can go past CAPACITY
+     * 
+     */
+    alignas(64) std::atomic<size_t> m_reserved{0};
+    /**
+     * @brief Amount of leading slots that are ready
+     * 
+     */
+    alignas(64) std::atomic<size_t> m_published{0};
+};
+
+}
+
+#endif // SVEC_SCONCURRENT_APPEND_VECTOR END
@@ -0,0 +1,669 @@
+// Copyright 2025 Dalton Prokosch
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SVEC_SEXPRESSION
+#define SVEC_SEXPRESSION
+
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+
+#include "sVector.hpp"
+
+namespace svec
+{
+
+/**
+ * @brief Checks if object is a SVector of an arithmetic type, the only SVectors the element-wise operators apply to
+ * 
+ * @tparam T type.
+ */
+template <typename T>
+struct IsArithmeticSVector : std::false_type {};
+
+/**
+ * @brief Checks if object is a SVector of an arithmetic type, the only SVectors the element-wise operators apply to
+ * 
+ * @tparam T type.
+ * @tparam CAPACITY
+ * @tparam ALIGNMENT
+ */
+template <typename T, size_t CAPACITY, size_t ALIGNMENT>
+struct IsArithmeticSVector<SVector<T, CAPACITY, ALIGNMENT>> : std::is_arithmetic<T> {};
+
+/**
+ * @brief Checks if object can be an operand sized by its elements, a numeric SVector or an expression
+ * 
+ * @tparam T type.
+ */
+template <typename T>
+struct IsVectorOperand : std::bool_constant<IsArithmeticSVector<T>::value || IsExpression<T>::value> {};
+
+/**
+ * @brief Checks if two objects can be combined element-wise, at least one has to be sized and the other can be a scalar
+ * 
+ * @tparam L type.
+ * @tparam R type.
+ */
+template <typename L, typename R>
+struct AreOperands : std::bool_constant<(IsVectorOperand<L>::value || IsVectorOperand<R>::value) &&
+                                        (IsVectorOperand<L>::value || std::is_arithmetic_v<L>) &&
+                                        (IsVectorOperand<R>::value || std::is_arithmetic_v<R>)> {};
+
+/**
+ * @brief Elements of a SVector inside an expression. Only the pointer and size are kept, so the SVector has to
+ * outlive the expression.
+ * 
+ * @tparam T arithmetic type
+ */
+template<typename T>
+class VectorOperand
+{
+public:
+    using ExpressionTag = void;
+    using ValueType = T;
+
+    /**
+     * @brief Construct a new VectorOperand object
+     * 
+     * @param data
+     * @param size
+     */
+    VectorOperand(const T* data, size_t size) :
+        m_data(data),
+        m_size{size}
+    {}
+    inline size_t size() const
+    {
+        return m_size;
+    }
+    inline T operator[](size_t i) const
+    {
+        return m_data[i];
+    }
+
+private:
+    const T* m_data;
+    size_t m_size;
+};
+
+/**
+ * @brief Scalar broadcast to every element of an expression
+ * 
+ * @tparam T arithmetic type
+ */
+template<typename T>
+class ScalarOperand
+{
+public:
+    using ExpressionTag = void;
+    using ValueType = T;
+
+    /**
+     * @brief Construct a new ScalarOperand object
+     * 
+     * @param value
+     */
+    ScalarOperand(T value) :
+        m_value{value}
+    {}
+    /**
+     * @brief Scalars never limit the size of an expression
+     * 
+     * @return size_t
+     */
+    inline size_t size() const
+    {
+        return SIZE_MAX;
+    }
+    inline T operator[](size_t) const
+    {
+        return m_value;
+    }
+
+private:
+    T m_value;
+};
+
+/**
+ * @brief Lazy OP applied to every element of an expression
+ * 
+ * @tparam OPERAND
+ * @tparam OP
+ */
+template<typename OPERAND, typename OP>
+class UnaryExpression
+{
+public:
+    using ExpressionTag = void;
+    using ValueType = decltype(OP{}(std::declval<typename OPERAND::ValueType>()));
+
+    /**
+     * @brief Construct a new UnaryExpression object
+     * 
+     * @param operand
+     */
+    UnaryExpression(OPERAND operand) :
+        m_operand(operand)
+    {}
+    inline size_t size() const
+    {
+        return m_operand.size();
+    }
+    inline ValueType operator[](size_t i) const
+    {
+        return OP{}(m_operand[i]);
+    }
+
+private:
+    OPERAND m_operand;
+};
+
+/**
+ * @brief Lazy OP applied to every pair of elements of two expressions, sized by the smaller one
+ * 
+ * @tparam LEFT
+ * @tparam RIGHT
+ * @tparam OP
+ */
+template<typename LEFT, typename RIGHT, typename OP>
+class BinaryExpression
+{
+public:
+    using ExpressionTag = void;
+    using ValueType = decltype(OP{}(std::declval<typename LEFT::ValueType>(), std::declval<typename RIGHT::ValueType>()));
+
+    /**
+     * @brief Construct a new BinaryExpression object
+     * 
+     * @param left
+     * @param right
+     */
+    BinaryExpression(LEFT left, RIGHT right) :
+        m_left(left),
+        m_right(right)
+    {}
+    inline size_t size() const
+    {
+        return std::min(m_left.size(), m_right.size());
+    }
+    inline ValueType operator[](size_t i) const
+    {
+        return OP{}(m_left[i], m_right[i]);
+    }
+
+private:
+    LEFT m_left;
+    RIGHT m_right;
+};
+
+/**
+ * @brief Element-wise operations used by the expressions. Minimum and maximum are written as a compare and select
+ * so they map onto packed min and max instructions.
+ * 
+ */
+namespace elementwise
+{
+
+struct Minimum
+{
+    template<typename T, typename U>
+    inline auto operator()(T a, U b) const
+    {
+        return b < a ? b : a;
+    }
+};
+struct Maximum
+{
+    template<typename T, typename U>
+    inline auto operator()(T a, U b) const
+    {
+        return a < b ? b : a;
+    }
+};
+struct Absolute
+{
+    template<typename T>
+    inline T operator()(T a) const
+    {
+        return a < T{0} ? -a : a;
+    }
+};
+struct SquareRoot
+{
+    template<typename T>
+    inline auto operator()(T a) const
+    {
+        return std::sqrt(a);
+    }
+};
+
+}
+
+/**
+ * @brief Wraps an operand for use inside an expression: expressions are copied, SVectors are referenced and
+ * scalars are broadcast
+ * 
+ * @tparam X
+ * @param x
+ * @return auto
+ */
+template<typename X>
+inline auto toOperand(const X& x)
+{
+    if constexpr (IsArithmeticSVector<X>::value)
+    {
+        return VectorOperand(x.data(), x.size());
+    }
+    else if constexpr (IsExpression<X>::value)
+    {
+        return x;
+    }
+    else
+    {
+        return ScalarOperand<X>(x);
+    }
+}
+
+/**
+ * @brief Builds a lazy element-wise OP of two operands
+ * 
+ * @tparam OP
+ * @tparam L
+ * @tparam R
+ * @param left
+ * @param right
+ * @return auto
+ */
+template<typename OP, typename L, typename R>
+inline auto makeExpression(const L& left, const R& right)
+{
+    using Left = decltype(toOperand(left));
+    using Right = decltype(toOperand(right));
+    return BinaryExpression<Left, Right, OP>(toOperand(left), toOperand(right));
+}
+/**
+ * @brief Builds a lazy element-wise OP of one operand
+ * 
+ * @tparam OP
+ * @tparam X
+ * @param x
+ * @return auto
+ */
+template<typename OP, typename X>
+inline auto makeExpression(const X& x)
+{
+    return UnaryExpression<decltype(toOperand(x)), OP>(toOperand(x));
+}
+
+/**
+ * @brief Lazy element-wise sum, either side can be a scalar
+ * 
+ * @return auto
+ */
+template<typename L, typename R, typename = std::enable_if_t<AreOperands<L, R>::value>>
+inline auto operator+(const L& left, const R& right)
+{
+    return makeExpression<std::plus<>>(left, right);
+}
+/**
+ * @brief Lazy element-wise difference, either side can be a scalar
+ * 
+ * @return auto
+ */
+template<typename L, typename R, typename = std::enable_if_t<AreOperands<L, R>::value>>
+inline auto operator-(const L& left, const R& right)
+{
+    return makeExpression<std::minus<>>(left, right);
+}
+/**
+ * @brief Lazy element-wise product, either side can be a scalar
+ * 
+ * @return auto
+ */
+template<typename L, typename R, typename = std::enable_if_t<AreOperands<L, R>::value>>
+inline auto operator*(const L& left, const R& right)
+{
+    return makeExpression<std::multiplies<>>(left, right);
+}
+/**
+ * @brief Lazy element-wise quotient, either side can be a scalar
+ * 
+ * @return auto
+ */
+template<typename L, typename R, typename = std::enable_if_t<AreOperands<L, R>::value>>
+inline auto operator/(const L& left, const R& right)
+{
+    return makeExpression<std::divides<>>(left, right);
+}
+/**
+ * @brief Lazy element-wise negation
+ * 
+ * @return auto
+ */
+template<typename X, typename = std::enable_if_t<IsVectorOperand<X>::value>>
+inline auto operator-(const X& x)
+{
+    return makeExpression<std::negate<>>(x);
+}
+/**
+ * @brief Lazy element-wise minimum
+ * 
+ * @return auto
+ */
+template<typename L, typename R, typename = std::enable_if_t<AreOperands<L, R>::value>>
+inline auto minimum(const L& left, const R& right)
+{
+    return makeExpression<elementwise::Minimum>(left, right);
+}
+/**
+ * @brief Lazy element-wise maximum
+ * 
+ * @return auto
+ */
+template<typename L, typename R, typename = std::enable_if_t<AreOperands<L, R>::value>>
+inline auto maximum(const L& left, const R& right)
+{
+    return makeExpression<elementwise::Maximum>(left, right);
+}
+/**
+ * @brief Lazy element-wise clamp into [low, high]
+ * 
+ * @return auto
+ */
+template<typename X, typename LOW, typename HIGH, typename = std::enable_if_t<IsVectorOperand<X>::value>>
+inline auto clamp(const X& x, const LOW& low, const HIGH& high)
+{
+    return minimum(maximum(x, low), high);
+}
+/**
+ * @brief Lazy element-wise absolute value
+ * 
+ * @return auto
+ */
+template<typename X, typename = std::enable_if_t<IsVectorOperand<X>::value>>
+inline auto abs(const X& x)
+{
+    return makeExpression<elementwise::Absolute>(x);
+}
+/**
+ * @brief Lazy element-wise square root
+ * 
+ * @return auto
+ */
+template<typename X, typename = std::enable_if_t<IsVectorOperand<X>::value>>
+inline auto sqrt(const X& x)
+{
+    return makeExpression<elementwise::SquareRoot>(x);
+}
+
+/**
+ * @brief Amount of independent accumulators used by reductions. Splitting the sum lets the compiler keep them in
+ * vector registers without reassociating floating point math, so the result can differ from a sequential
+ * sum by rounding.
+ * 
+ */
+inline constexpr size_t REDUCTION_LANES = 8;
+
+/**
+ * @brief Sums elements
+ * 
+ * @tparam X SVector or expression
+ * @param x
+ * @return auto
+ */
+template<typename X, typename = std::enable_if_t<IsVectorOperand<X>::value>>
+auto sum(const X& x)
+{
+    auto operand = toOperand(x);
+    using V = typename decltype(operand)::ValueType;
+    size_t size = operand.size();
+    V lanes[REDUCTION_LANES] = {};
+    size_t i = 0;
+    for (; i + REDUCTION_LANES <= size; i += REDUCTION_LANES)
+    {
+        for (size_t lane = 0; lane < REDUCTION_LANES; lane++)
+        {
+            lanes[lane] += operand[i + lane];
+        }
+    }
+    for (; i < size; i++)
+    {
+        lanes[i % REDUCTION_LANES] += operand[i];
+    }
+    for (size_t width = REDUCTION_LANES / 2; width > 0; width /= 2)
+    {
+        for (size_t lane = 0; lane < width; lane++)
+        {
+            lanes[lane] += lanes[lane + width];
+        }
+    }
+    return lanes[0];
+}
+/**
+ * @brief Sums products of elements of a and b in one pass
+ * 
+ * @param a
+ * @param b
+ * @return auto
+ */
+template<typename A, typename B, typename = std::enable_if_t<IsVectorOperand<A>::value && IsVectorOperand<B>::value>>
+inline auto dot(const A& a, const B& b)
+{
+    return sum(a * b);
+}
+/**
+ * @brief Euclidean length
+ * 
+ * @param x
+ * @return auto
+ */
+template<typename X, typename = std::enable_if_t<IsVectorOperand<X>::value>>
+inline auto norm(const X& x)
+{
+    return std::sqrt(dot(x, x));
+}
+/**
+ * @brief Reduces elements with a compare and select per lane
+ * 
+ * @tparam OP elementwise::Minimum or elementwise::Maximum
+ * @param x
+ * @return auto
+ */
+template<typename OP, typename X>
+auto selectReduce(const X& x)
+{
+    auto operand = toOperand(x);
+    using V = typename decltype(operand)::ValueType;
+    size_t size = operand.size();
+#ifdef _DEBUG
+    if (size == 0)
+    {
+        throw std::out_of_range("ERROR: can not reduce an empty SVector");
+    }
+#endif // _DEBUG end
+    V lanes[REDUCTION_LANES];
+    for (size_t lane = 0; lane < REDUCTION_LANES; lane++)
+    {
+        lanes[lane] = operand[0];
+    }
+    size_t i = 0;
+    for (; i + REDUCTION_LANES <= size; i += REDUCTION_LANES)
+    {
+        for (size_t lane = 0; lane < REDUCTION_LANES; lane++)
+        {
+            lanes[lane] = OP{}(lanes[lane], operand[i + lane]);
+        }
+    }
+    for (; i < size; i++)
+    {
+        lanes[0] = OP{}(lanes[0], operand[i]);
+    }
+    for (size_t lane = 1; lane < REDUCTION_LANES; lane++)
+    {
+        lanes[0] = OP{}(lanes[0], lanes[lane]);
+    }
+    return lanes[0];
+}
+/**
+ * @brief Returns smallest element, x must not be empty
+ * 
+ * @param x
+ * @return auto
+ */
+template<typename X, typename = std::enable_if_t<IsVectorOperand<X>::value>>
+inline auto min(const X& x)
+{
+    return selectReduce<elementwise::Minimum>(x);
+}
+/**
+ * @brief Returns largest element, x must not be empty
+ * 
+ * @param x
+ * @return auto
+ */
+template<typename X, typename = std::enable_if_t<IsVectorOperand<X>::value>>
+inline auto max(const X& x)
+{
+    return selectReduce<elementwise::Maximum>(x);
+}
+/**
+ * @brief Returns index of the first largest element, x must not be empty.
+ * Each lane tracks its best value and index, the lanes are merged preferring the lower index on ties.
+ * 
+ * @param x
+ * @return size_t
+ */
+template<typename X, typename = std::enable_if_t<IsVectorOperand<X>::value>>
+size_t argmax(const X& x)
+{
+    auto operand = toOperand(x);
+    using V = typename decltype(operand)::ValueType;
+    size_t size = operand.size();
+#ifdef _DEBUG
+    if (size == 0)
+    {
+        throw std::out_of_range("ERROR: can not reduce an empty SVector");
+    }
+#endif // _DEBUG end
+    V best[REDUCTION_LANES];
+    size_t index[REDUCTION_LANES];
+    for (size_t lane = 0; lane < REDUCTION_LANES; lane++)
+    {
+        best[lane] = operand[0];
+        index[lane] = 0;
+    }
+    size_t i = 0;
+    for (; i + REDUCTION_LANES <= size; i += REDUCTION_LANES)
+    {
+        for (size_t lane = 0; lane < REDUCTION_LANES; lane++)
+        {
+            V value = operand[i + lane];
+            bool better = best[lane] < value;
+            best[lane] = better ? value : best[lane];
+            index[lane] = better ? i + lane : index[lane];
+        }
+    }
+    size_t result = 0;
+    V value = operand[0];
+    for (size_t lane = 0; lane < REDUCTION_LANES; lane++)
+    {
+        if (value < best[lane] || (!(best[lane] < value) && index[lane] < result))
+        {
+            value = best[lane];
+            result = index[lane];
+        }
+    }
+    for (; i < size; i++)
+    {
+        if (value < operand[i])
+        {
+            value = operand[i];
+            result = i;
+        }
+    }
+    return result;
+}
+
+/**
+ * @brief Sequential loops computing the same reductions one element at a time, the baseline for tests and benchmarks
+ * 
+ */
+namespace reference
+{
+
+template<typename X>
+auto sum(const X& x)
+{
+    auto operand = toOperand(x);
+    typename decltype(operand)::ValueType total{};
+    for (size_t i = 0; i < operand.size(); i++)
+    {
+        total += operand[i];
+    }
+    return total;
+}
+template<typename A, typename B>
+auto dot(const A& a, const B& b)
+{
+    return reference::sum(a * b);
+}
+template<typename X>
+auto norm(const X& x)
+{
+    return std::sqrt(reference::dot(x, x));
+}
+template<typename X>
+auto min(const X& x)
+{
+    auto operand = toOperand(x);
+    auto result = operand[0];
+    for (size_t i = 1; i < operand.size(); i++)
+    {
+        result = operand[i] < result ? operand[i] : result;
+    }
+    return result;
+}
+template<typename X>
+auto max(const X& x)
+{
+    auto operand = toOperand(x);
+    auto result = operand[0];
+    for (size_t i = 1; i < operand.size(); i++)
+    {
+        result = result < operand[i] ? operand[i] : result;
+    }
+    return result;
+}
+template<typename X>
+size_t argmax(const X& x)
+{
+    auto operand = toOperand(x);
+    size_t result = 0;
+    for (size_t i = 1; i < operand.size(); i++)
+    {
+        if (operand[result] < operand[i])
+        {
+            result = i;
+        }
+    }
+    return result;
+}
+
+}
+
+}
+
+#endif // SVEC_SEXPRESSION END
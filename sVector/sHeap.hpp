@@ -0,0 +1,423 @@
+// Copyright 2025 Dalton Prokosch
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SVEC_SHEAP
+#define SVEC_SHEAP
+
+#include <functional>
+
+#include "sVector.hpp"
+
+namespace svec
+{
+
+/**
+ * @brief D-ary heap stored on the stack. Element at the top is the one that compares less than every other element,
+ * so the default std::less gives a min heap. A 4-ary heap keeps a node's children in one or two cache lines
+ * and halves the height of a binary heap.
+ * 
+ * @tparam T type stored in heap
+ * @tparam CAPACITY size allocated on stack
+ * @tparam COMPARE strict weak ordering, top is the least element
+ * @tparam ARITY children per node
+ */
+template<typename T, size_t CAPACITY, typename COMPARE = std::less<T>, size_t ARITY = 4>
+class SHeap
+{
+    static_assert(ARITY >= 2, "SHeap requires an arity of at least 2");
+public:
+    /**
+     * @brief Construct a new empty SHeap object
+     * 
+     * @param compare
+     */
+    SHeap(const COMPARE& compare = COMPARE()) :
+        m_compare(compare)
+    {
+
+    }
+    /**
+     * @brief Construct a new SHeap object from an array, heapifies in O(n)
+     * 
+     * @param initList
+     * @param compare
+     */
+    SHeap(std::initializer_list<T>&& initList, const COMPARE& compare = COMPARE()) :
+        m_data(std::move(initList)),
+        m_compare(compare)
+    {
+        for (size_t i = m_data.size() / ARITY + 1; i-- > 0;)
+        {
+            siftDown(i);
+        }
+    }
+
+    /**
+     * @brief Returns least element
+     * 
+     * @return const T&
+     */
+    inline const T& top() const
+    {
+        return m_data.front();
+    }
+    /**
+     * @brief Accesses element stored at index of the underlying array, used to find indices for decreaseKey
+     * 
+     * @param i
+     * @return const T&
+     */
+    inline const T& operator[](size_t i) const
+    {
+        return m_data[i];
+    }
+    /**
+     * @brief Returns size of SHeap
+     * 
+     * @return size_t
+     */
+    inline size_t size() const
+    {
+        return m_data.size();
+    }
+    /**
+     * @brief Returns size of array
+     * 
+     * @return size_t
+     */
+    inline size_t capacity() const
+    {
+        return CAPACITY;
+    }
+    /**
+     * @brief Checks if SHeap is empty
+     * 
+     * @return true
+     * @return false
+     */
+    inline bool empty() const
+    {
+        return m_data.size() == 0;
+    }
+    /**
+     * @brief Returns iterator at start of underlying array, elements are in heap order
+     * 
+     * @return SVector<T, CAPACITY>::ConstIterator
+     */
+    inline typename SVector<T, CAPACITY>::ConstIterator begin() const
+    {
+        return m_data.begin();
+    }
+    /**
+     * @brief Returns iterator at end of underlying array
+     * 
+     * @return SVector<T, CAPACITY>::ConstIterator
+     */
+    inline typename SVector<T, CAPACITY>::ConstIterator end() const
+    {
+        return m_data.end();
+    }
+
+    /**
+     * @brief Adds element to SHeap in O(log n)
+     * 
+     * @param element
+     */
+    inline void push(const T& element)
+    {
+        m_data.pushBack(element);
+        siftUp(m_data.size() - 1);
+    }
+    /**
+     * @brief Adds element to SHeap in O(log n)
+     * 
+     * @param element
+     */
+    inline void push(T&& element)
+    {
+        m_data.pushBack(std::move(element));
+        siftUp(m_data.size() - 1);
+    }
+    /**
+     * @brief Constructs element in SHeap in O(log n)
+     * 
+     * @tparam ARGS
+     * @param args
+     */
+    template<typename... ARGS>
+    inline void emplace(ARGS&&... args)
+    {
+        m_data.emplaceBack(std::forward<ARGS>(args)...);
+        siftUp(m_data.size() - 1);
+    }
+    /**
+     * @brief Removes least element in O(log n)
+     * 
+     */
+    inline void pop()
+    {
+        if (m_data.size() > 1)
+        {
+            m_data.front() = std::move(m_data.back());
+        }
+        m_data.popBack();
+        siftDown(0);
+    }
+    /**
+     * @brief Replaces least element with element, cheaper than pop followed by push since it only sifts down once
+     * 
+     * @param element
+     */
+    inline void replaceTop(T element)
+    {
+        m_data.front() = std::move(element);
+        siftDown(0);
+    }
+    /**
+     * @brief Replaces element at index with a value that compares less than or equal to it and restores heap order
+     * 
+     * @param index index in underlying array
+     * @param element new value
+     */
+    inline void decreaseKey(size_t index, T element)
+    {
+    #ifdef _DEBUG
+        if (m_compare(m_data[index], element))
+        {
+            throw std::invalid_argument("ERROR: decreaseKey was given a value greater than the current value");
+        }
+    #endif // _DEBUG end
+        m_data[index] = std::move(element);
+        siftUp(index);
+    }
+    /**
+     * @brief Removes all elements
+     * 
+     */
+    inline void clear()
+    {
+        while (m_data.size() > 0)
+        {
+            m_data.popBack();
+        }
+    }
+
+private:
+    /**
+     * @brief Moves element at index towards the top until its parent is not greater than it
+     * 
+     * @param index
+     */
+    inline void siftUp(size_t index)
+    {
+        if (index == 0)
+        {
+            return;
+        }
+        T element = std::move(m_data[index]);
+        while (index > 0)
+        {
+            size_t parent = (index - 1) / ARITY;
+            if (!m_compare(element, m_data[parent]))
+            {
+                break;
+            }
+            m_data[index] = std::move(m_data[parent]);
+            index = parent;
+        }
+        m_data[index] = std::move(element);
+    }
+    /**
+     * @brief Moves element at index towards the bottom until none of its children are less than it
+     * 
+     * @param index
+     */
+    inline void siftDown(size_t index)
+    {
+        const size_t size = m_data.size();
+        if (index * ARITY + 1 >= size)
+        {
+            return;
+        }
+        T element = std::move(m_data[index]);
+        while (true)
+        {
+            size_t first = index * ARITY + 1;
+            if (first >= size)
+            {
+                break;
+            }
+            size_t last = std::min(first + ARITY, size);
+            size_t best = first;
+            for (size_t child = first + 1; child < last; child++)
+            {
+                best = m_compare(m_data[child], m_data[best]) ? child : best;
+            }
+            if (!m_compare(m_data[best], element))
+            {
+                break;
+            }
+            m_data[index] = std::move(m_data[best]);
+            index = best;
+        }
+        m_data[index] = std::move(element);
+    }
+
+    /**
+     * @brief Elements in heap order
+     * 
+     */
+    SVector<T, CAPACITY> m_data;
+    /**
+     * @brief Ordering used by heap
+     * 
+     */
+    [[no_unique_address]] COMPARE m_compare;
+};
+
+/**
+ * @brief Keeps the K greatest elements of a stream. Internally a min heap of the kept elements,
+ * so a candidate costs one comparison against the smallest kept element and is either dropped or replaces it.
+ * 
+ * @tparam T type stored
+ * @tparam K amount of elements kept
+ * @tparam COMPARE strict weak ordering, greatest elements are kept
+ * @tparam ARITY children per node of internal heap
+ */
+template<typename T, size_t K, typename COMPARE = std::less<T>, size_t ARITY = 4>
+class STopK
+{
+    static_assert(K > 0, "STopK requires K of at least 1");
+public:
+    /**
+     * @brief Construct a new empty STopK object
+     * 
+     * @param compare
+     */
+    STopK(const COMPARE& compare = COMPARE()) :
+        m_heap(compare),
+        m_compare(compare)
+    {
+
+    }
+
+    /**
+     * @brief Offers element to STopK, kept if it is among the K greatest seen so far
+     * 
+     * @param element
+     * @return true element was kept
+     * @return false element was dropped
+     */
+    inline bool push(const T& element)
+    {
+        if (m_heap.size() < K)
+        {
+            m_heap.push(element);
+            return true;
+        }
+        if (!m_compare(m_heap.top(), element))
+        {
+            return false;
+        }
+        m_heap.replaceTop(element);
+        return true;
+    }
+    /**
+     * @brief Returns smallest element kept, a new element has to be greater than this to be kept once full
+     * 
+     * @return const T&
+     */
+    inline const T& threshold() const
+    {
+        return m_heap.top();
+    }
+    /**
+     * @brief Returns amount of elements kept
+     * 
+     * @return size_t
+     */
+    inline size_t size() const
+    {
+        return m_heap.size();
+    }
+    /**
+     * @brief Checks if K elements are kept
+     * 
+     * @return true
+     * @return false
+     */
+    inline bool full() const
+    {
+        return m_heap.size() == K;
+    }
+    /**
+     * @brief Returns iterator at start of kept elements, elements are in heap order
+     * 
+     * @return SVector<T, K>::ConstIterator
+     */
+    inline typename SVector<T, K>::ConstIterator begin() const
+    {
+        return m_heap.begin();
+    }
+    /**
+     * @brief Returns iterator at end of kept elements
+     * 
+     * @return SVector<T, K>::ConstIterator
+     */
+    inline typename SVector<T, K>::ConstIterator end() const
+    {
+        return m_heap.end();
+    }
+    /**
+     * @brief Returns kept elements ordered greatest first
+     * 
+     * @return SVector<T, K>
+     */
+    SVector<T, K> sorted() const
+    {
+        SHeap<T, K, COMPARE, ARITY> heap = m_heap;
+        SVector<T, K> result;
+        result.resizeForOverwrite(heap.size());
+        for (size_t i = heap.size(); i-- > 0;)
+        {
+            result[i] = heap.top();
+            heap.pop();
+        }
+        return result;
+    }
+    /**
+     * @brief Removes all kept elements
+     * 
+     */
+    inline void clear()
+    {
+        m_heap.clear();
+    }
+
+private:
+    /**
+     * @brief Kept elements, top is the smallest kept element
+     * 
+     */
+    SHeap<T, K, COMPARE, ARITY> m_heap;
+    /**
+     * @brief Ordering used to decide what is kept
+     * 
+     */
+    [[no_unique_address]] COMPARE m_compare;
+};
+
+}
+
+#endif // SVEC_SHEAP END
@@ -0,0 +1,299 @@
+// Copyright 2025 Dalton Prokosch
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SVEC_SJAGGED_ARRAY
+#define SVEC_SJAGGED_ARRAY
+
+#include <cstdint>
+#include <span>
+#include <utility>
+
+#include "sVector.hpp"
+
+namespace svec
+{
+
+/**
+ * @brief Array of variable length rows stored on the stack in one contiguous buffer (compressed sparse row layout).
+ * Row i is the elements between offset i and offset i + 1, so walking every row streams through memory.
+ * 
+ * @tparam T type stored in container
+ * @tparam TOTAL_CAPACITY max amount of elements across all rows
+ * @tparam MAX_ROWS max amount of rows
+ */
+template<typename T, size_t TOTAL_CAPACITY, size_t MAX_ROWS>
+class SJaggedArray
+{
+public:
+    /**
+     * @brief Smallest unsigned type that can hold TOTAL_CAPACITY, used for the offset table
+     * 
+     */
+    using OffsetType = std::conditional_t<TOTAL_CAPACITY <= UINT16_MAX, uint16_t,
+                       std::conditional_t<TOTAL_CAPACITY <= UINT32_MAX, uint32_t, size_t>>;
+
+    /**
+     * @brief Construct a new SJaggedArray object with no rows
+     * 
+     */
+    SJaggedArray() :
+        m_offsets({0})
+    {
+
+    }
+
+    /**
+     * @brief Builds rows from (row, value) pairs with a counting sort, replacing current contents.
+     * Values keep their relative order within a row.
+     * 
+     * @param pairs row index and value of every element
+     * @param rowCount amount of rows, every row index in pairs has to be less than this
+     */
+    void assign(std::span<const std::pair<size_t, T>> pairs, size_t rowCount)
+    {
+    #ifdef _DEBUG
+        if (rowCount > MAX_ROWS)
+        {
+            throw std::out_of_range("ERROR: row count " + std::to_string(rowCount) + " is larger than max rows " + std::to_string(MAX_ROWS));
+        }
+    #endif // _DEBUG end
+        m_offsets.resizeForOverwrite(rowCount + 1);
+        std::fill(m_offsets.begin(), m_offsets.end(), 0);
+        for (const std::pair<size_t, T>& pair : pairs)
+        {
+            m_offsets[pair.first + 1]++;
+        }
+        for (size_t row = 0; row < rowCount; row++)
+        {
+            m_offsets[row + 1] += m_offsets[row];
+        }
+
+        SVector<OffsetType, MAX_ROWS + 1> cursors = m_offsets;
+        m_data.resizeForOverwrite(pairs.size());
+        for (const std::pair<size_t, T>& pair : pairs)
+        {
+            m_data[cursors[pair.first]++] = pair.second;
+        }
+    }
+
+    /**
+     * @brief Returns elements of a row
+     * 
+     * @param row
+     * @return std::span<T>
+     */
+    inline std::span<T> operator[](size_t row)
+    {
+    #ifdef _DEBUG
+        if (row >= rows())
+        {
+            throw std::out_of_range("ERROR: row " + std::to_string(row) + " is larger than row count " + std::to_string(rows()));
+        }
+    #endif // _DEBUG end
+        return std::span<T>(m_data.data() + m_offsets[row], m_offsets[row + 1] - m_offsets[row]);
+    }
+    /**
+     * @brief Returns elements of a row
+     * 
+     * @param row
+     * @return std::span<const T>
+     */
+    inline std::span<const T> operator[](size_t row) const
+    {
+    #ifdef _DEBUG
+        if (row >= rows())
+        {
+            throw std::out_of_range("ERROR: row " + std::to_string(row) + " is larger than row count " + std::to_string(rows()));
+        }
+    #endif // _DEBUG end
+        return std::span<const T>(m_data.data() + m_offsets[row], m_offsets[row + 1] - m_offsets[row]);
+    }
+    /**
+     * @brief Returns amount of elements in a row
+     * 
+     * @param row
+     * @return size_t
+     */
+    inline size_t rowSize(size_t row) const
+    {
+        return m_offsets[row + 1] - m_offsets[row];
+    }
+    /**
+     * @brief Returns amount of rows
+     * 
+     * @return size_t
+     */
+    inline size_t rows() const
+    {
+        return m_offsets.size() - 1;
+    }
+    /**
+     * @brief Returns amount of elements across all rows
+     * 
+     * @return size_t
+     */
+    inline size_t size() const
+    {
+        return m_data.size();
+    }
+    /**
+     * @brief Returns max amount of elements across all rows
+     * 
+     * @return size_t
+     */
+    inline size_t capacity() const
+    {
+        return TOTAL_CAPACITY;
+    }
+    /**
+     * @brief Returns every element, rows one after another
+     * 
+     * @return std::span<T>
+     */
+    inline std::span<T> elements()
+    {
+        return std::span<T>(m_data.data(), m_data.size());
+    }
+    /**
+     * @brief Returns every element, rows one after another
+     * 
+     * @return std::span<const T>
+     */
+    inline std::span<const T> elements() const
+    {
+        return std::span<const T>(m_data.data(), m_data.size());
+    }
+
+    /**
+     * @brief Adds an empty row
+     * 
+     */
+    inline void appendRow()
+    {
+        m_offsets.pushBack(m_offsets.back());
+    }
+    /**
+     * @brief Adds a row holding copies of values
+     * 
+     * @param values
+     */
+    inline void appendRow(std::span<const T> values)
+    {
+        appendRow();
+        for (const T& value : values)
+        {
+            pushBack(value);
+        }
+    }
+    /**
+     * @brief Adds a row holding copies of values
+     * 
+     * @param values
+     */
+    inline void appendRow(std::initializer_list<T> values)
+    {
+        appendRow(std::span<const T>(values.begin(), values.size()));
+    }
+    /**
+     * @brief Adds element to the back of the last row
+     * 
+     * @param element
+     */
+    inline void pushBack(const T& element)
+    {
+    #ifdef _DEBUG
+        checkHasRow();
+    #endif // _DEBUG end
+        m_data.pushBack(element);
+        m_offsets.back()++;
+    }
+    /**
+     * @brief Adds element to the back of the last row
+     * 
+     * @param element
+     */
+    inline void pushBack(T&& element)
+    {
+    #ifdef _DEBUG
+        checkHasRow();
+    #endif // _DEBUG end
+        m_data.pushBack(std::move(element));
+        m_offsets.back()++;
+    }
+    /**
+     * @brief Emplaces element at the back of the last row
+     * 
+     * @tparam ARGS
+     * @param args
+     * @return T& emplaced element
+     */
+    template<typename... ARGS>
+    inline T& emplaceBack(ARGS&&... args)
+    {
+    #ifdef _DEBUG
+        checkHasRow();
+    #endif // _DEBUG end
+        T& element = m_data.emplaceBack(std::forward<ARGS>(args)...);
+        m_offsets.back()++;
+        return element;
+    }
+    /**
+     * @brief Removes last row and its elements
+     * 
+     */
+    inline void popRow()
+    {
+    #ifdef _DEBUG
+        checkHasRow();
+    #endif // _DEBUG end
+        m_offsets.popBack();
+        m_data.resizeForOverwrite(m_offsets.back());
+    }
+    /**
+     * @brief Removes all rows
+     * 
+     */
+    inline void clear()
+    {
+        m_data.clear();
+        m_offsets.resizeForOverwrite(1);
+    }
+
+private:
+    /**
+     * @brief Throws when there is no row, the last offset would otherwise be the start of the first row
+     * 
+     */
+    void checkHasRow() const
+    {
+        if (rows() == 0)
+        {
+            throw std::out_of_range("ERROR: no open row, SJaggedArray has no rows");
+        }
+    }
+    /**
+     * @brief Elements of every row, rows one after another
+     * 
+     */
+    SVector<T, TOTAL_CAPACITY> m_data;
+    /**
+     * @brief Start of every row followed by the end of the last row
+     * 
+     */
+    SVector<OffsetType, MAX_ROWS + 1> m_offsets;
+};
+
+}
+
+#endif // SVEC_SJAGGED_ARRAY END
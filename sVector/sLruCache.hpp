@@ -0,0 +1,368 @@
+// Copyright 2025 Dalton Prokosch
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SVEC_SLRU_CACHE
+#define SVEC_SLRU_CACHE
+
+#include <bit>
+#include <cstdint>
+#include <functional>
+#include <limits>
+
+#include "sVector.hpp"
+
+namespace svec
+{
+
+/**
+ * @brief Least recently used cache stored on the stack. Entries sit densely in an SVector, recency is a doubly linked
+ * list of 16 or 32 bit indices into it and keys are found through an open addressing table of the same indices.
+ * Nothing is allocated after construction and get, put and eviction are O(1).
+ * 
+ * @tparam K key type
+ * @tparam V value type
+ * @tparam CAPACITY max amount of entries, least recently used entry is evicted once full
+ * @tparam HASH hash of K
+ * @tparam KEY_EQUAL equality of K
+ */
+template<typename K, typename V, size_t CAPACITY, typename HASH = std::hash<K>, typename KEY_EQUAL = std::equal_to<K>>
+class SLruCache
+{
+    static_assert(CAPACITY > 0, "SLruCache requires a capacity of at least 1");
+public:
+    /**
+     * @brief Smallest unsigned type that can index every entry and still has a value left for "none"
+     * 
+     */
+    using IndexType = std::conditional_t<CAPACITY < UINT16_MAX, uint16_t, uint32_t>;
+
+    /**
+     * @brief Key and value stored in the cache
+     * 
+     */
+    struct Entry
+    {
+        K key;
+        V value;
+    };
+
+    /**
+     * @brief Construct a new empty SLruCache object
+     * 
+     * @param hash
+     * @param keyEqual
+     */
+    SLruCache(const HASH& hash = HASH(), const KEY_EQUAL& keyEqual = KEY_EQUAL()) :
+        m_hash(hash),
+        m_keyEqual(keyEqual)
+    {
+        std::fill(m_buckets, m_buckets + BUCKETS, NONE);
+    }
+
+    /**
+     * @brief Finds value of key and marks it as most recently used
+     * 
+     * @param key
+     * @return V* value, nullptr if key is not cached
+     */
+    inline V* get(const K& key)
+    {
+        IndexType slot = m_buckets[findBucket(key)];
+        if (slot == NONE)
+        {
+            return nullptr;
+        }
+        moveToFront(slot);
+        return &m_entries[slot].value;
+    }
+    /**
+     * @brief Finds value of key without changing recency
+     * 
+     * @param key
+     * @return const V* value, nullptr if key is not cached
+     */
+    inline const V* peek(const K& key) const
+    {
+        IndexType slot = m_buckets[findBucket(key)];
+        return slot == NONE ? nullptr : &m_entries[slot].value;
+    }
+    /**
+     * @brief Checks if key is cached without changing recency
+     * 
+     * @param key
+     * @return true
+     * @return false
+     */
+    inline bool contains(const K& key) const
+    {
+        return m_buckets[findBucket(key)] != NONE;
+    }
+    /**
+     * @brief Sets value of key and marks it as most recently used. Evicts least recently used entry when full.
+     * 
+     * @param key
+     * @param value
+     * @return V& cached value
+     */
+    V& put(const K& key, V value)
+    {
+        size_t bucket = findBucket(key);
+        IndexType slot = m_buckets[bucket];
+        if (slot != NONE)
+        {
+            m_entries[slot].value = std::move(value);
+            moveToFront(slot);
+            return m_entries[slot].value;
+        }
+
+        if (m_entries.size() == CAPACITY)
+        {
+            slot = m_tail;
+            removeBucket(findBucket(m_entries[slot].key));
+            unlink(slot);
+            m_entries[slot].key = key;
+            m_entries[slot].value = std::move(value);
+            // Removing the evicted key may have shifted the empty bucket found earlier
+            bucket = findBucket(key);
+        }
+        else
+        {
+            slot = static_cast<IndexType>(m_entries.size());
+            m_entries.uncheckedEmplaceBack(key, std::move(value));
+        }
+        m_buckets[bucket] = slot;
+        linkFront(slot);
+        return m_entries[slot].value;
+    }
+    /**
+     * @brief Removes key, the last entry is moved into its slot so entries stay dense
+     * 
+     * @param key
+     * @return true key was removed
+     * @return false key was not cached
+     */
+    bool erase(const K& key)
+    {
+        size_t bucket = findBucket(key);
+        IndexType slot = m_buckets[bucket];
+        if (slot == NONE)
+        {
+            return false;
+        }
+        removeBucket(bucket);
+        unlink(slot);
+
+        IndexType last = static_cast<IndexType>(m_entries.size() - 1);
+        if (slot != last)
+        {
+            m_buckets[findBucket(m_entries[last].key)] = slot;
+            m_entries[slot] = std::move(m_entries[last]);
+            m_prev[slot] = m_prev[last];
+            m_next[slot] = m_next[last];
+            (m_prev[slot] == NONE ? m_head : m_next[m_prev[slot]]) = slot;
+            (m_next[slot] == NONE ? m_tail : m_prev[m_next[slot]]) = slot;
+        }
+        m_entries.popBack();
+        return true;
+    }
+    /**
+     * @brief Removes every entry
+     * 
+     */
+    inline void clear()
+    {
+        m_entries.clear();
+        std::fill(m_buckets, m_buckets + BUCKETS, NONE);
+        m_head = NONE;
+        m_tail = NONE;
+    }
+
+    /**
+     * @brief Returns most recently used entry, cache can not be empty
+     * 
+     * @return const Entry&
+     */
+    inline const Entry& mostRecent() const
+    {
+        return m_entries[m_head];
+    }
+    /**
+     * @brief Returns entry that will be evicted next, cache can not be empty
+     * 
+     * @return const Entry&
+     */
+    inline const Entry& leastRecent() const
+    {
+        return m_entries[m_tail];
+    }
+    /**
+     * @brief Returns amount of entries
+     * 
+     * @return size_t
+     */
+    inline size_t size() const
+    {
+        return m_entries.size();
+    }
+    /**
+     * @brief Returns max amount of entries
+     * 
+     * @return size_t
+     */
+    inline size_t capacity() const
+    {
+        return CAPACITY;
+    }
+
+private:
+    /**
+     * @brief Marks a missing link and an empty bucket
+     * 
+     */
+    static constexpr IndexType NONE = std::numeric_limits<IndexType>::max();
+    /**
+     * @brief Bucket count, at least twice the capacity so probe sequences stay short
+     * 
+     */
+    static constexpr size_t BUCKETS = std::bit_ceil(CAPACITY * 2);
+    static constexpr size_t BUCKET_MASK = BUCKETS - 1;
+
+    /**
+     * @brief Returns first bucket to probe for key. Hash is mixed since std::hash of integers is the identity.
+     * 
+     * @param key
+     * @return size_t
+     */
+    inline size_t homeBucket(const K& key) const
+    {
+        uint64_t hash = static_cast<uint64_t>(m_hash(key)) * 0x9E3779B97F4A7C15ull;
+        return static_cast<size_t>(hash >> 32) & BUCKET_MASK;
+    }
+    /**
+     * @brief Returns bucket holding key, or the empty bucket ending its probe sequence
+     * 
+     * @param key
+     * @return size_t
+     */
+    inline size_t findBucket(const K& key) const
+    {
+        size_t bucket = homeBucket(key);
+        while (m_buckets[bucket] != NONE && !m_keyEqual(m_entries[m_buckets[bucket]].key, key))
+        {
+            bucket = (bucket + 1) & BUCKET_MASK;
+        }
+        return bucket;
+    }
+    /**
+     * @brief Empties bucket and shifts later buckets of the probe run back, so no tombstones are needed
+     * 
+     * @param bucket
+     */
+    inline void removeBucket(size_t bucket)
+    {
+        size_t hole = bucket;
+        for (size_t next = (bucket + 1) & BUCKET_MASK; m_buckets[next] != NONE; next = (next + 1) & BUCKET_MASK)
+        {
+            size_t home = homeBucket(m_entries[m_buckets[next]].key);
+            if (((next - home) & BUCKET_MASK) >= ((next - hole) & BUCKET_MASK))
+            {
+                m_buckets[hole] = m_buckets[next];
+                hole = next;
+            }
+        }
+        m_buckets[hole] = NONE;
+    }
+    /**
+     * @brief Removes slot from recency list
+     * 
+     * @param slot
+     */
+    inline void unlink(IndexType slot)
+    {
+        IndexType prev = m_prev[slot];
+        IndexType next = m_next[slot];
+        (prev == NONE ? m_head : m_next[prev]) = next;
+        (next == NONE ? m_tail : m_prev[next]) = prev;
+    }
+    /**
+     * @brief Adds slot to the most recent end of recency list
+     * 
+     * @param slot
+     */
+    inline void linkFront(IndexType slot)
+    {
+        m_prev[slot] = NONE;
+        m_next[slot] = m_head;
+        (m_head == NONE ? m_tail : m_prev[m_head]) = slot;
+        m_head = slot;
+    }
+    /**
+     * @brief Marks slot as most recently used
+     * 
+     * @param slot
+     */
+    inline void moveToFront(IndexType slot)
+    {
+        if (slot != m_head)
+        {
+            unlink(slot);
+            linkFront(slot);
+        }
+    }
+
+    /**
+     * @brief Entries, densely packed
+     * 
+     */
+    SVector<Entry, CAPACITY> m_entries;
+    /**
+     * @brief Next more recently used slot of every slot
+     * 
+     */
+    IndexType m_prev[CAPACITY];
+    /**
+     * @brief Next less recently used slot of every slot
+     * 
+     */
+    IndexType m_next[CAPACITY];
+    /**
+     * @brief Open addressing table of slots, probed linearly
+     * 
+     */
+    IndexType m_buckets[BUCKETS];
+    /**
+     * @brief Most recently used slot
+     * 
+     */
+    IndexType m_head = NONE;
+    /**
+     * @brief Least recently used slot
+     * 
+     */
+    IndexType m_tail = NONE;
+    /**
+     * @brief Hashes keys
+     * 
+     */
+    HASH m_hash;
+    /**
+     * @brief Compares keys
+     * 
+     */
+    KEY_EQUAL m_keyEqual;
+};
+
+}
+
+#endif // SVEC_SLRU_CACHE END
@@ -0,0 +1,758 @@
+// Copyright 2025 Dalton Prokosch
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SVEC_SMAPPED_VECTOR
+#define SVEC_SMAPPED_VECTOR
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+#include <system_error>
+
+#include "sVector.hpp"
+
+namespace svec
+{
+
+/**
+ * @brief Options for mapping a SMappedVector
+ * 
+ */
+struct MappedOptions
+{
+    /**
+     * @brief Map an existing file read only and shared, so many processes share one copy of its pages.
+     * Mutators throw in debug builds, in release builds writing faults.
+     * 
+     */
+    bool readOnly = false;
+    /**
+     * @brief Back an anonymous mapping with explicit huge pages (MAP_HUGETLB), needs reserved huge pages
+     * 
+     */
+    bool hugeTlb = false;
+    /**
+     * @brief Ask for transparent huge pages with madvise(MADV_HUGEPAGE), ignored if the kernel refuses
+     * 
+     */
+    bool adviseHugePages = false;
+    /**
+     * @brief Hashed into the type fingerprint, tells apart element types with the same layout
+     * 
+     */
+    uint64_t typeTag = 0;
+};
+
+/**
+ * @brief Header stored at the start of a SMappedVector file
+ * 
+ */
+struct MappedHeader
+{
+    /**
+     * @brief Identifies SMappedVector files
+     * 
+     */
+    uint64_t magic;
+    /**
+     * @brief Hash of the element layout and type tag
+     * 
+     */
+    uint64_t fingerprint;
+    /**
+     * @brief Capacity file was created with
+     * 
+     */
+    uint64_t capacity;
+    /**
+     * @brief Size of vector
+     * 
+     */
+    uint64_t size;
+};
+
+/**
+ * @brief Hashes layout facts of T and a user supplied tag so a file is never reopened as a different type.
+ * Only uses properties every compiler agrees on, so files move between builds and compilers.
+ * 
+ * @tparam T
+ * @param tag distinguishes types the layout facts can not, such as two structs with the same members
+ * @return uint64_t
+ */
+template<typename T>
+constexpr uint64_t typeFingerprint(uint64_t tag = 0)
+{
+    const uint64_t facts[] = {
+        sizeof(T),
+        alignof(T),
+        std::is_trivially_copyable_v<T>,
+        std::is_standard_layout_v<T>,
+        std::is_trivially_default_constructible_v<T>,
+        std::is_integral_v<T>,
+        std::is_floating_point_v<T>,
+        std::is_signed_v<T>,
+        std::is_pointer_v<T>,
+        std::is_enum_v<T>,
+        std::is_class_v<T>,
+        tag
+    };
+    uint64_t hash = 14695981039346656037ull;
+    for (uint64_t fact : facts)
+    {
+        hash = (hash ^ fact) * 1099511628211ull;
+    }
+    return hash;
+}
+
+/**
+ * @brief Vector like container with the same interface as SVector whose memory is a mmap, so capacities too large
+ * for the stack are fine. Backed either by an anonymous mapping or by a file holding a header and the elements,
+ * reopening a file maps it instantly and pages are only read when touched.
+ * 
+ * @tparam T trivially copyable type stored in container
+ * @tparam CAPACITY max amount of elements
+ */
+template<typename T, size_t CAPACITY>
+class SMappedVector
+{
+    static_assert(std::is_trivially_copyable_v<T>, "SMappedVector requires a trivially copyable type");
+public:
+    /**
+     * @brief Random access iterator over the mapped elements
+     * 
+     */
+    using Iterator = T*;
+    /**
+     * @brief Random access iterator over the mapped elements
+     * 
+     */
+    using ConstIterator = const T*;
+
+    /**
+     * @brief Value stored in MappedHeader::magic
+     * 
+     */
+    static constexpr uint64_t MAGIC = 0x5356454d41505631ull;
+    /**
+     * @brief Alignment of the first element in the mapping
+     * 
+     */
+    static constexpr size_t DATA_ALIGNMENT = std::max(alignof(T), CACHE_LINE_SIZE);
+    /**
+     * @brief Byte offset of the first element in the mapping
+     * 
+     */
+    static constexpr size_t DATA_OFFSET = (sizeof(MappedHeader) + DATA_ALIGNMENT - 1) / DATA_ALIGNMENT * DATA_ALIGNMENT;
+    /**
+     * @brief Byte size of the mapping
+     * 
+     */
+    static constexpr size_t MAPPING_SIZE = DATA_OFFSET + CAPACITY * sizeof(T);
+
+    /**
+     * @brief Construct a new SMappedVector object backed by an anonymous private mapping
+     * 
+     * @param options
+     */
+    SMappedVector(MappedOptions options = {})
+    {
+        int flags = MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE;
+        size_t length = MAPPING_SIZE;
+        if (options.hugeTlb)
+        {
+            constexpr size_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+            flags |= MAP_HUGETLB;
+            length = (length + HUGE_PAGE_SIZE - 1) / HUGE_PAGE_SIZE * HUGE_PAGE_SIZE;
+        }
+        map(-1, length, PROT_READ | PROT_WRITE, flags, options);
+        *m_header = MappedHeader{MAGIC, typeFingerprint<T>(options.typeTag), CAPACITY, 0};
+    }
+    /**
+     * @brief Construct a new SMappedVector object backed by a shared file mapping. Creates the file when it is empty
+     * or missing, otherwise checks its header matches T and CAPACITY.
+     * 
+     * @param path
+     * @param options
+     */
+    SMappedVector(const char* path, MappedOptions options = {})
+    {
+        int fd = ::open(path, options.readOnly ? O_RDONLY : (O_RDWR | O_CREAT), 0644);
+        if (fd == -1)
+        {
+            throw std::system_error(errno, std::generic_category(), "ERROR: could not open " + std::string(path));
+        }
+        struct stat status;
+        if (fstat(fd, &status) == -1)
+        {
+            int error = errno;
+            ::close(fd);
+            throw std::system_error(error, std::generic_category(), "ERROR: could not stat " + std::string(path));
+        }
+        bool created = status.st_size == 0 && !options.readOnly;
+        if (created && ftruncate(fd, MAPPING_SIZE) == -1)
+        {
+            int error = errno;
+            ::close(fd);
+            throw std::system_error(error, std::generic_category(), "ERROR: could not size " + std::string(path));
+        }
+        if (!created && static_cast<size_t>(status.st_size) != MAPPING_SIZE)
+        {
+            ::close(fd);
+            throw std::runtime_error("ERROR: " + std::string(path) + " has size " + std::to_string(status.st_size) + " expected " + std::to_string(MAPPING_SIZE));
+        }
+        int protection = options.readOnly ? PROT_READ : (PROT_READ | PROT_WRITE);
+        try
+        {
+            map(fd, MAPPING_SIZE, protection, MAP_SHARED, options);
+        }
+        catch (...)
+        {
+            ::close(fd);
+            throw;
+        }
+        ::close(fd);
+
+        if (created)
+        {
+            *m_header = MappedHeader{MAGIC, typeFingerprint<T>(options.typeTag), CAPACITY, 0};
+        }
+        else if (m_header->magic != MAGIC || m_header->fingerprint != typeFingerprint<T>(options.typeTag) || m_header->capacity != CAPACITY)
+        {
+            unmap();
+            throw std::runtime_error("ERROR: " + std::string(path) + " was not created by a SMappedVector of this type and capacity");
+        }
+    }
+    SMappedVector(const SMappedVector&) = delete;
+    SMappedVector& operator=(const SMappedVector&) = delete;
+    /**
+     * @brief Moves mapping, other is left empty
+     * 
+     * @param other
+     */
+    SMappedVector(SMappedVector&& other) noexcept :
+        m_mapping{std::exchange(other.m_mapping, nullptr)},
+        m_length{other.m_length},
+        m_readOnly{other.m_readOnly},
+        m_header{std::exchange(other.m_header, nullptr)},
+        m_array{std::exchange(other.m_array, nullptr)}
+    {
+
+    }
+    /**
+     * @brief Unmaps current memory and takes mapping of other
+     * 
+     * @param other
+     * @return SMappedVector& this
+     */
+    SMappedVector& operator=(SMappedVector&& other) noexcept
+    {
+        if (this != &other)
+        {
+            unmap();
+            m_mapping = std::exchange(other.m_mapping, nullptr);
+            m_length = other.m_length;
+            m_readOnly = other.m_readOnly;
+            m_header = std::exchange(other.m_header, nullptr);
+            m_array = std::exchange(other.m_array, nullptr);
+        }
+        return *this;
+    }
+    /**
+     * @brief Unmaps memory, file backed changes are written back by the kernel
+     * 
+     */
+    ~SMappedVector()
+    {
+        unmap();
+    }
+
+    /**
+     * @brief Flushes changes of a file backed mapping to disk
+     * 
+     * @param async schedule the write instead of waiting for it
+     */
+    void checkpoint(bool async = false)
+    {
+        if (msync(m_mapping, m_length, async ? MS_ASYNC : MS_SYNC) == -1)
+        {
+            throw std::system_error(errno, std::generic_category(), "ERROR: msync failed");
+        }
+    }
+
+    /**
+     * @brief Checks if two SMappedVectors are equal. Compares values using T::operator==(T) or memcmp
+     * 
+     * @tparam C capacity of other SMappedVector
+     * @param other
+     * @return bool
+     */
+    template<size_t C>
+    bool operator==(const SMappedVector<T, C>& other) const
+    {
+        return equals(other.data(), other.size());
+    }
+    /**
+     * @brief Checks if a SMappedVector is equal to a SVector. Compares values using T::operator==(T) or memcmp
+     * 
+     * @tparam C capacity of SVector
+     * @tparam A alignment of SVector
+     * @param other
+     * @return bool
+     */
+    template<size_t C, size_t A>
+    bool operator==(const SVector<T, C, A>& other) const
+    {
+        return equals(other.data(), other.size());
+    }
+    /**
+     * @brief Checks if a SMappedVector is equal to an array. Compares values using T::operator==(T) or memcmp
+     * 
+     * @param initList
+     * @return bool
+     */
+    bool operator==(const std::initializer_list<T>& initList) const
+    {
+        return equals(initList.begin(), initList.size());
+    }
+
+    /**
+     * @brief Returns iterator at start of array
+     * 
+     * @return Iterator
+     */
+    inline Iterator begin()
+    {
+        return m_array;
+    }
+    /**
+     * @brief Returns iterator at start of array
+     * 
+     * @return ConstIterator
+     */
+    inline ConstIterator begin() const
+    {
+        return m_array;
+    }
+    /**
+     * @brief Returns iterator at end of array
+     * 
+     * @return Iterator
+     */
+    inline Iterator end()
+    {
+        return m_array + size();
+    }
+    /**
+     * @brief Returns iterator at end of array
+     * 
+     * @return ConstIterator
+     */
+    inline ConstIterator end() const
+    {
+        return m_array + size();
+    }
+    /**
+     * @brief Accesses element of array
+     * 
+     * @param i
+     * @return T&
+     */
+    inline T& operator[](size_t i)
+    {
+    #ifdef _DEBUG
+        if (i >= size())
+        {
+            throw std::out_of_range("ERROR: index " + std::to_string(i) + " is larger than size " + std::to_string(size()));
+        }
+    #endif // _DEBUG end
+        return m_array[i];
+    }
+    /**
+     * @brief Accesses element of array
+     * 
+     * @param i
+     * @return const T&
+     */
+    inline const T& operator[](size_t i) const
+    {
+    #ifdef _DEBUG
+        if (i >= size())
+        {
+            throw std::out_of_range("ERROR: index " + std::to_string(i) + " is larger than size " + std::to_string(size()));
+        }
+    #endif // _DEBUG end
+        return m_array[i];
+    }
+    /**
+     * @brief Returns pointer to the first element
+     * 
+     * @return T*
+     */
+    inline T* data()
+    {
+        return m_array;
+    }
+    /**
+     * @brief Returns pointer to the first element
+     * 
+     * @return const T*
+     */
+    inline const T* data() const
+    {
+        return m_array;
+    }
+    /**
+     * @brief Returns size of SMappedVector, 0 once moved from
+     * 
+     * @return size_t
+     */
+    inline size_t size() const
+    {
+        return m_header == nullptr ? 0 : m_header->size;
+    }
+    /**
+     * @brief Returns size of array
+     * 
+     * @return size_t
+     */
+    inline size_t capacity() const
+    {
+        return CAPACITY;
+    }
+    /**
+     * @brief Returns last element
+     * 
+     * @return T&
+     */
+    inline T& back()
+    {
+        return m_array[m_header->size - 1];
+    }
+    /**
+     * @brief Returns last element
+     * 
+     * @return const T&
+     */
+    inline const T& back() const
+    {
+        return m_array[m_header->size - 1];
+    }
+    /**
+     * @brief Returns first element
+     * 
+     * @return T&
+     */
+    inline T& front()
+    {
+        return m_array[0];
+    }
+    /**
+     * @brief Returns first element
+     * 
+     * @return const T&
+     */
+    inline const T& front() const
+    {
+        return m_array[0];
+    }
+
+    /**
+     * @brief Adds element to back and increases size
+     * 
+     * @param element
+     */
+    inline void pushBack(const T& element)
+    {
+        emplaceBack(element);
+    }
+    /**
+     * @brief Adds element to back and increases size
+     * 
+     * @param element
+     */
+    inline void pushBack(T&& element)
+    {
+        emplaceBack(std::move(element));
+    }
+    /**
+     * @brief Adds element to front and increases size
+     * 
+     * @param element
+     */
+    inline void pushFront(const T& element)
+    {
+        insert(0, element);
+    }
+    /**
+     * @brief Adds element to front and increases size
+     * 
+     * @param element
+     */
+    inline void pushFront(T&& element)
+    {
+        insert(0, std::move(element));
+    }
+    /**
+     * @brief Emplaces element at the back
+     * 
+     * @tparam ARGS
+     * @param args
+     * @return T& emplaced element
+     */
+    template<typename... ARGS>
+    inline T& emplaceBack(ARGS&&... args)
+    {
+    #ifdef _DEBUG
+        checkWritable();
+        checkNotFull();
+    #endif // _DEBUG end
+        T* element = std::construct_at(m_array + m_header->size, std::forward<ARGS>(args)...);
+        m_header->size++;
+        return *element;
+    }
+    /**
+     * @brief Emplaces element at the front
+     * 
+     * @tparam ARGS
+     * @param args
+     * @return T& emplaced element
+     */
+    template<typename... ARGS>
+    inline T& emplaceFront(ARGS&&... args)
+    {
+        return emplace(0, std::forward<ARGS>(args)...);
+    }
+    /**
+     * @brief Emplaces element at index. Element is constructed before shifting, so args may refer to elements of
+     * this SMappedVector.
+     * 
+     * @tparam ARGS
+     * @param index
+     * @param args
+     * @return T& emplaced element
+     */
+    template<typename... ARGS>
+    inline T& emplace(size_t index, ARGS&&... args)
+    {
+    #ifdef _DEBUG
+        checkWritable();
+        checkNotFull();
+    #endif // _DEBUG end
+        T element(std::forward<ARGS>(args)...);
+        memmove(m_array + index + 1, m_array + index, (m_header->size - index) * sizeof(T));
+        m_array[index] = std::move(element);
+        m_header->size++;
+        return m_array[index];
+    }
+    /**
+     * @brief Removes element from back
+     * 
+     */
+    inline void popBack()
+    {
+    #ifdef _DEBUG
+        checkWritable();
+    #endif // _DEBUG end
+        m_header->size--;
+    }
+    /**
+     * @brief Removes element from front
+     * 
+     */
+    inline void popFront()
+    {
+        erase(0);
+    }
+    /**
+     * @brief Inserts element into array
+     * 
+     * @param index
+     * @param element
+     */
+    inline void insert(size_t index, const T& element)
+    {
+        emplace(index, element);
+    }
+    /**
+     * @brief Inserts element into array
+     * 
+     * @param index
+     * @param element
+     */
+    inline void insert(size_t index, T&& element)
+    {
+        emplace(index, std::move(element));
+    }
+    /**
+     * @brief Removes element from array
+     * 
+     * @param index
+     */
+    inline void erase(size_t index)
+    {
+    #ifdef _DEBUG
+        checkWritable();
+    #endif // _DEBUG end
+        m_header->size--;
+        memmove(m_array + index, m_array + index + 1, (m_header->size - index) * sizeof(T));
+    }
+    /**
+     * @brief Changes size to count, new elements are not initialized
+     * 
+     * @param count
+     */
+    inline void resizeForOverwrite(size_t count)
+    {
+    #ifdef _DEBUG
+        checkWritable();
+        if (count > CAPACITY)
+        {
+            throw std::out_of_range("ERROR: size " + std::to_string(count) + " is larger than capacity " + std::to_string(CAPACITY));
+        }
+    #endif // _DEBUG end
+        m_header->size = count;
+    }
+    /**
+     * @brief Removes all elements, pages stay mapped
+     * 
+     */
+    inline void clear()
+    {
+    #ifdef _DEBUG
+        checkWritable();
+    #endif // _DEBUG end
+        m_header->size = 0;
+    }
+
+private:
+    /**
+     * @brief Throws when the mapping is read only, writing to it would otherwise crash with SIGSEGV
+     * 
+     */
+    void checkWritable() const
+    {
+        if (m_readOnly)
+        {
+            throw std::logic_error("ERROR: can not modify a read only SMappedVector");
+        }
+    }
+    /**
+     * @brief Throws when there is no room for another element, writing past capacity would leave the mapping
+     * 
+     */
+    void checkNotFull() const
+    {
+        if (m_header->size >= CAPACITY)
+        {
+            throw std::out_of_range("ERROR: can not add element, SMappedVector is at capacity " + std::to_string(CAPACITY));
+        }
+    }
+    /**
+     * @brief Compares elements with count elements at other
+     * 
+     * @param other
+     * @param count
+     * @return bool
+     */
+    bool equals(const T* other, size_t count) const
+    {
+        if (count != size())
+        {
+            return false;
+        }
+        if constexpr (HasEquals<T>::value)
+        {
+            return std::equal(m_array, m_array + count, other);
+        }
+        else
+        {
+            return count == 0 || memcmp(m_array, other, count * sizeof(T)) == 0;
+        }
+    }
+    /**
+     * @brief Maps length bytes and points header and array into the mapping
+     * 
+     * @param fd file descriptor or -1 for anonymous
+     * @param length
+     * @param protection
+     * @param flags
+     * @param options
+     */
+    void map(int fd, size_t length, int protection, int flags, const MappedOptions& options)
+    {
+        void* mapping = mmap(nullptr, length, protection, flags, fd, 0);
+        if (mapping == MAP_FAILED)
+        {
+            throw std::system_error(errno, std::generic_category(), "ERROR: mmap of " + std::to_string(length) + " bytes failed");
+        }
+        if (options.adviseHugePages)
+        {
+            madvise(mapping, length, MADV_HUGEPAGE);
+        }
+        m_mapping = mapping;
+        m_length = length;
+        m_readOnly = (protection & PROT_WRITE) == 0;
+        m_header = static_cast<MappedHeader*>(mapping);
+        m_array = reinterpret_cast<T*>(static_cast<char*>(mapping) + DATA_OFFSET);
+    }
+    /**
+     * @brief Unmaps memory if mapped
+     * 
+     */
+    void unmap()
+    {
+        if (m_mapping != nullptr)
+        {
+            munmap(m_mapping, m_length);
+            m_mapping = nullptr;
+        }
+    }
+
+    /**
+     * @brief Start of mapping
+     * 
+     */
+    void* m_mapping = nullptr;
+    /**
+     * @brief Byte size of mapping
+     * 
+     */
+    size_t m_length = 0;
+    /**
+     * @brief Mapping was made without PROT_WRITE
+     * 
+     */
+    bool m_readOnly = false;
+    /**
+     * @brief Header at start of mapping, holds size
+     * 
+     */
+    MappedHeader* m_header = nullptr;
+    /**
+     * @brief Elements, DATA_OFFSET bytes into mapping
+     * 
+     */
+    T* m_array = nullptr;
+};
+
+}
+
+#endif // SVEC_SMAPPED_VECTOR END
@@ -0,0 +1,440 @@
+// Copyright 2025 Dalton Prokosch
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SVEC_SPARALLEL
+#define SVEC_SPARALLEL
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <functional>
+#include <optional>
+#include <type_traits>
+
+#include "sThreadPool.hpp"
+#include "sVector.hpp"
+
+namespace svec
+{
+
+/**
+ * @brief Parallel algorithms over the live elements of a SVector, SMappedVector or any container with data() and size().
+ * The range is split into chunks of about CHUNK_BYTES that are run on a SThreadPool with join, so the thread calling
+ * an algorithm works on chunks too. Ranges below sequentialCutoff() run on the calling thread.
+ * Callables are called from several threads at once and must not throw.
+ * 
+ */
+namespace parallel
+{
+
+/**
+ * @brief Bytes of elements a chunk covers, small enough to stay in a core's L2 cache
+ * 
+ */
+constexpr size_t CHUNK_BYTES = 64 * 1024;
+/**
+ * @brief Max amount of chunks inclusiveScan splits into, their partial results are kept on the stack
+ * 
+ */
+constexpr size_t MAX_SCAN_CHUNKS = 256;
+
+/**
+ * @brief Returns the pool used by the algorithms not taking one, started on first use with a worker less than cores
+ * 
+ * @return SThreadPool&
+ */
+inline SThreadPool& defaultPool()
+{
+    static SThreadPool pool;
+    return pool;
+}
+/**
+ * @brief Amount of elements below which the algorithms run sequentially on the calling thread
+ * 
+ * @return std::atomic<size_t>&
+ */
+inline std::atomic<size_t>& sequentialCutoffStorage()
+{
+    static std::atomic<size_t> cutoff{1 << 15};
+    return cutoff;
+}
+/**
+ * @brief Returns amount of elements below which the algorithms run sequentially
+ * 
+ * @return size_t
+ */
+inline size_t sequentialCutoff()
+{
+    return sequentialCutoffStorage().load(std::memory_order_relaxed);
+}
+/**
+ * @brief Sets amount of elements below which the algorithms run sequentially, for every thread
+ * 
+ * @param cutoff
+ */
+inline void setSequentialCutoff(size_t cutoff)
+{
+    sequentialCutoffStorage().store(cutoff, std::memory_order_relaxed);
+}
+/**
+ * @brief Returns amount of elements of T in a chunk
+ * 
+ * @tparam T
+ * @return size_t
+ */
+template<typename T>
+inline constexpr size_t chunkSize()
+{
+    return std::max<size_t>(CHUNK_BYTES / sizeof(T), 1);
+}
+/**
+ * @brief Keeps the overloads running on the default pool from matching calls that pass a pool
+ * 
+ * @tparam T type of first argument
+ */
+template<typename T>
+using NotPool = std::enable_if_t<!std::is_same_v<std::remove_cv_t<T>, SThreadPool>>;
+/**
+ * @brief Checks if count elements should be run on the calling thread, always the case for empty ranges
+ * 
+ * @param pool
+ * @param count
+ * @return true
+ * @return false
+ */
+inline bool runSequentially(const SThreadPool& pool, size_t count)
+{
+    return count == 0 || count < sequentialCutoff() || pool.workers() == 0;
+}
+
+/**
+ * @brief Reduces count elements in order, splitting into halves with join until they fit a chunk
+ * 
+ * @tparam T result type
+ * @tparam E element type
+ * @tparam OP
+ * @param pool
+ * @param first
+ * @param count at least 1
+ * @param op
+ * @return T
+ */
+template<typename T, typename E, typename OP>
+T reduceRange(SThreadPool& pool, const E* first, size_t count, const OP& op)
+{
+    if (count <= chunkSize<E>())
+    {
+        T result = first[0];
+        for (size_t i = 1; i < count; i++)
+        {
+            result = op(std::move(result), first[i]);
+        }
+        return result;
+    }
+    size_t half = count / 2;
+    std::optional<T> left;
+    std::optional<T> right;
+    pool.join([&]() { left.emplace(reduceRange<T>(pool, first, half, op)); },
+              [&]() { right.emplace(reduceRange<T>(pool, first + half, count - half, op)); });
+    return op(std::move(*left), std::move(*right));
+}
+/**
+ * @brief Quicksorts [first, last) with a median of three pivot, sorting both sides of a partition with join.
+ * Ranges that fit a chunk, or that are left once depth runs out on a bad pivot sequence, are handed to std::sort.
+ * 
+ * @tparam T
+ * @tparam COMPARE
+ * @param pool
+ * @param first
+ * @param last
+ * @param compare
+ * @param depth partitions left before falling back to std::sort
+ */
+template<typename T, typename COMPARE>
+void sortRange(SThreadPool& pool, T* first, T* last, const COMPARE& compare, size_t depth)
+{
+    size_t size = static_cast<size_t>(last - first);
+    if (size <= chunkSize<T>() || depth == 0)
+    {
+        std::sort(first, last, compare);
+        return;
+    }
+    const T& a = *first;
+    const T& b = first[size / 2];
+    const T& c = *(last - 1);
+    // copied since partitioning moves the elements around
+    T pivot = compare(a, b) ? (compare(b, c) ? b : (compare(a, c) ? c : a)) :
+                              (compare(a, c) ? a : (compare(b, c) ? c : b));
+    T* lessEnd = std::partition(first, last, [&](const T& element) { return compare(element, pivot); });
+    T* equalEnd = std::partition(lessEnd, last, [&](const T& element) { return !compare(pivot, element); });
+    pool.join([&]() { sortRange(pool, first, lessEnd, compare, depth - 1); },
+              [&]() { sortRange(pool, equalEnd, last, compare, depth - 1); });
+}
+
+/**
+ * @brief Calls function on every element
+ * 
+ * @tparam VEC container with data() and size()
+ * @tparam FUNCTION callable taking an element reference
+ * @param pool
+ * @param vec
+ * @param function
+ */
+template<typename VEC, typename FUNCTION>
+void forEach(SThreadPool& pool, VEC& vec, const FUNCTION& function)
+{
+    auto* data = vec.data();
+    size_t size = vec.size();
+    auto run = [&](size_t first, size_t last)
+    {
+        for (size_t i = first; i < last; i++)
+        {
+            function(data[i]);
+        }
+    };
+    if (runSequentially(pool, size))
+    {
+        run(0, size);
+        return;
+    }
+    pool.parallelFor(0, size, chunkSize<std::remove_reference_t<decltype(*data)>>(), run);
+}
+/**
+ * @brief Calls function on every element on the default pool
+ * 
+ * @tparam VEC container with data() and size()
+ * @tparam FUNCTION callable taking an element reference
+ * @param vec
+ * @param function
+ */
+template<typename VEC, typename FUNCTION, typename = NotPool<VEC>>
+inline void forEach(VEC& vec, const FUNCTION& function)
+{
+    forEach(defaultPool(), vec, function);
+}
+
+/**
+ * @brief Resizes out to the size of in and sets out[i] to function(in[i]), in and out may be the same container
+ * 
+ * @tparam IN container with data() and size()
+ * @tparam OUT container with data() and resizeForOverwrite()
+ * @tparam FUNCTION callable taking a const element reference of in and returning an element of out
+ * @param pool
+ * @param in
+ * @param out
+ * @param function
+ */
+template<typename IN, typename OUT, typename FUNCTION>
+void transform(SThreadPool& pool, const IN& in, OUT& out, const FUNCTION& function)
+{
+    size_t size = in.size();
+    out.resizeForOverwrite(size);
+    const auto* source = in.data();
+    auto* destination = out.data();
+    auto run = [&](size_t first, size_t last)
+    {
+        for (size_t i = first; i < last; i++)
+        {
+            destination[i] = function(source[i]);
+        }
+    };
+    if (runSequentially(pool, size))
+    {
+        run(0, size);
+        return;
+    }
+    pool.parallelFor(0, size, chunkSize<std::remove_reference_t<decltype(*destination)>>(), run);
+}
+/**
+ * @brief Resizes out to the size of in and sets out[i] to function(in[i]) on the default pool
+ * 
+ * @tparam IN container with data() and size()
+ * @tparam OUT container with data() and resizeForOverwrite()
+ * @tparam FUNCTION callable taking a const element reference of in and returning an element of out
+ * @param in
+ * @param out
+ * @param function
+ */
+template<typename IN, typename OUT, typename FUNCTION, typename = NotPool<IN>>
+inline void transform(const IN& in, OUT& out, const FUNCTION& function)
+{
+    transform(defaultPool(), in, out, function);
+}
+
+/**
+ * @brief Folds every element into init with op. Elements keep their order so op only has to be associative,
+ * but floating point sums round differently than a sequential loop.
+ * 
+ * @tparam VEC container with data() and size()
+ * @tparam T result type
+ * @tparam OP callable taking two T or T and an element and returning T
+ * @param pool
+ * @param vec
+ * @param init
+ * @param op
+ * @return T
+ */
+template<typename VEC, typename T, typename OP = std::plus<>>
+T reduce(SThreadPool& pool, const VEC& vec, T init, const OP& op = {})
+{
+    const auto* data = vec.data();
+    size_t size = vec.size();
+    if (runSequentially(pool, size))
+    {
+        for (size_t i = 0; i < size; i++)
+        {
+            init = op(std::move(init), data[i]);
+        }
+        return init;
+    }
+    return op(std::move(init), reduceRange<T>(pool, data, size, op));
+}
+/**
+ * @brief Folds every element into init with an associative op on the default pool
+ * 
+ * @tparam VEC container with data() and size()
+ * @tparam T result type
+ * @tparam OP callable taking two T or T and an element and returning T
+ * @param vec
+ * @param init
+ * @param op
+ * @return T
+ */
+template<typename VEC, typename T, typename OP = std::plus<>, typename = NotPool<VEC>>
+inline T reduce(const VEC& vec, T init, const OP& op = {})
+{
+    return reduce(defaultPool(), vec, std::move(init), op);
+}
+
+/**
+ * @brief Resizes out to the size of in and sets out[i] to in[0] op ... op in[i], in and out may be the same container.
+ * Chunk totals are reduced in parallel, scanned on the calling thread and then every chunk is scanned from its
+ * offset in parallel, so op has to be associative and every element is read twice.
+ * 
+ * @tparam IN container with data() and size()
+ * @tparam OUT container with data() and resizeForOverwrite() holding the same default constructible element type
+ * @tparam OP callable taking two elements and returning one
+ * @param pool
+ * @param in
+ * @param out
+ * @param op
+ */
+template<typename IN, typename OUT, typename OP = std::plus<>>
+void inclusiveScan(SThreadPool& pool, const IN& in, OUT& out, const OP& op = {})
+{
+    using T = std::remove_cv_t<std::remove_reference_t<decltype(*in.data())>>;
+    size_t size = in.size();
+    out.resizeForOverwrite(size);
+    const T* source = in.data();
+    T* destination = out.data();
+    auto scan = [&](size_t first, size_t last, std::optional<T> running)
+    {
+        for (size_t i = first; i < last; i++)
+        {
+            running.emplace(running ? op(std::move(*running), source[i]) : source[i]);
+            destination[i] = *running;
+        }
+    };
+    if (runSequentially(pool, size))
+    {
+        scan(0, size, std::nullopt);
+        return;
+    }
+
+    size_t chunks = std::min(MAX_SCAN_CHUNKS, (size + chunkSize<T>() - 1) / chunkSize<T>());
+    size_t length = (size + chunks - 1) / chunks;
+    chunks = (size + length - 1) / length;
+    SVector<T, MAX_SCAN_CHUNKS> totals;
+    totals.resizeForOverwrite(chunks);
+    pool.parallelFor(0, chunks - 1, 1, [&](size_t first, size_t last)
+    {
+        for (size_t chunk = first; chunk < last; chunk++)
+        {
+            T total = source[chunk * length];
+            for (size_t i = chunk * length + 1; i < (chunk + 1) * length; i++)
+            {
+                total = op(std::move(total), source[i]);
+            }
+            totals[chunk] = std::move(total);
+        }
+    });
+    for (size_t chunk = 1; chunk + 1 < chunks; chunk++)
+    {
+        totals[chunk] = op(totals[chunk - 1], totals[chunk]);
+    }
+    pool.parallelFor(0, chunks, 1, [&](size_t first, size_t last)
+    {
+        for (size_t chunk = first; chunk < last; chunk++)
+        {
+            scan(chunk * length, std::min(size, (chunk + 1) * length), chunk == 0 ? std::nullopt : std::optional<T>(totals[chunk - 1]));
+        }
+    });
+}
+/**
+ * @brief Resizes out to the size of in and sets out[i] to in[0] op ... op in[i] on the default pool
+ * 
+ * @tparam IN container with data() and size()
+ * @tparam OUT container with data() and resizeForOverwrite() holding the same default constructible element type
+ * @tparam OP callable taking two elements and returning one
+ * @param in
+ * @param out
+ * @param op
+ */
+template<typename IN, typename OUT, typename OP = std::plus<>, typename = NotPool<IN>>
+inline void inclusiveScan(const IN& in, OUT& out, const OP& op = {})
+{
+    inclusiveScan(defaultPool(), in, out, op);
+}
+
+/**
+ * @brief Sorts elements in place with a parallel quicksort, not stable. The first partitions run on one thread
+ * before the halves fan out, so speedup grows slower than the amount of threads. Needs no scratch buffer.
+ * 
+ * @tparam VEC container with data() and size()
+ * @tparam COMPARE strict weak ordering of two const element references
+ * @param pool
+ * @param vec
+ * @param compare
+ */
+template<typename VEC, typename COMPARE = std::less<>>
+void sort(SThreadPool& pool, VEC& vec, const COMPARE& compare = {})
+{
+    auto* data = vec.data();
+    size_t size = vec.size();
+    if (runSequentially(pool, size))
+    {
+        std::sort(data, data + size, compare);
+        return;
+    }
+    sortRange(pool, data, data + size, compare, 2 * std::bit_width(size));
+}
+/**
+ * @brief Sorts elements in place with a parallel quicksort on the default pool, not stable
+ * 
+ * @tparam VEC container with data() and size()
+ * @tparam COMPARE strict weak ordering of two const element references
+ * @param vec
+ * @param compare
+ */
+template<typename VEC, typename COMPARE = std::less<>, typename = NotPool<VEC>>
+inline void sort(VEC& vec, const COMPARE& compare = {})
+{
+    sort(defaultPool(), vec, compare);
+}
+
+}
+
+}
+
+#endif // SVEC_SPARALLEL END
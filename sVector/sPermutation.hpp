@@ -0,0 +1,259 @@
+// Copyright 2025 Dalton Prokosch
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SVEC_SPERMUTATION
+#define SVEC_SPERMUTATION
+
+#include <bitset>
+#include <cstdint>
+#include <string>
+#include <tuple>
+
+#if defined(__AVX2__) || defined(__AVX512F__)
+#include <immintrin.h>
+#endif
+
+#include "sVector.hpp"
+
+namespace svec
+{
+
+/**
+ * @brief Gather and scatter loops. With AVX2 4 and 8 byte elements addressed by 32 bit indices are gathered 8 or 4
+ * at a time, with AVX-512 4 byte elements are gathered and scattered 16 at a time. Tails and every other
+ * element or index type use a scalar loop.
+ * 
+ */
+namespace permutationKernels
+{
+
+/**
+ * @brief Checks if elements of T addressed by indices of I can go through the hardware gather and scatter instructions
+ * 
+ * @tparam T
+ * @tparam I
+ * @tparam SIZE element size the instruction moves
+ */
+template<typename T, typename I, size_t SIZE>
+struct IsVectorizable : std::bool_constant<std::is_trivially_copyable_v<T> && sizeof(T) == SIZE &&
+                                           std::is_integral_v<I> && sizeof(I) == 4> {};
+
+/**
+ * @brief Sets destination[i] to source[indices[i]] for every i below count
+ * 
+ * @tparam T
+ * @tparam I
+ * @param source
+ * @param indices every index below 2^31 when a hardware gather is used
+ * @param count
+ * @param destination
+ */
+template<typename T, typename I>
+inline void gather(const T* source, const I* indices, size_t count, T* destination)
+{
+    size_t i = 0;
+#ifdef __AVX512F__
+    if constexpr (IsVectorizable<T, I, 4>::value)
+    {
+        for (; i + 16 <= count; i += 16)
+        {
+            __m512i lanes = _mm512_loadu_si512(indices + i);
+            _mm512_storeu_si512(destination + i, _mm512_i32gather_epi32(lanes, source, 4));
+        }
+    }
+#endif // __AVX512F__ end
+#ifdef __AVX2__
+    if constexpr (IsVectorizable<T, I, 4>::value)
+    {
+        for (; i + 8 <= count; i += 8)
+        {
+            __m256i lanes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(indices + i));
+            __m256i values = _mm256_i32gather_epi32(reinterpret_cast<const int*>(source), lanes, 4);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(destination + i), values);
+        }
+    }
+    else if constexpr (IsVectorizable<T, I, 8>::value)
+    {
+        for (; i + 4 <= count; i += 4)
+        {
+            __m128i lanes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(indices + i));
+            __m256i values = _mm256_i32gather_epi64(reinterpret_cast<const long long*>(source), lanes, 8);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(destination + i), values);
+        }
+    }
+#endif // __AVX2__ end
+    for (; i < count; i++)
+    {
+        destination[i] = source[indices[i]];
+    }
+}
+/**
+ * @brief Sets destination[indices[i]] to source[i] for every i below count, the last write wins on repeated indices
+ * 
+ * @tparam T
+ * @tparam I
+ * @param source
+ * @param indices every index below 2^31 when a hardware scatter is used
+ * @param count
+ * @param destination
+ */
+template<typename T, typename I>
+inline void scatter(const T* source, const I* indices, size_t count, T* destination)
+{
+    size_t i = 0;
+#ifdef __AVX512F__
+    if constexpr (IsVectorizable<T, I, 4>::value)
+    {
+        // lanes are written from lowest to highest so repeated indices keep the same last write wins order
+        for (; i + 16 <= count; i += 16)
+        {
+            __m512i lanes = _mm512_loadu_si512(indices + i);
+            _mm512_i32scatter_epi32(destination, lanes, _mm512_loadu_si512(source + i), 4);
+        }
+    }
+#endif // __AVX512F__ end
+    for (; i < count; i++)
+    {
+        destination[indices[i]] = source[i];
+    }
+}
+
+}
+
+/**
+ * @brief Replaces destination with source[indices[0]], source[indices[1]], ...
+ * 
+ * @tparam T 
+ * @tparam I integer index type
+ * @param source 
+ * @param indices every index less than source.size()
+ * @param destination different SVector from source
+ */
+template<typename T, size_t C1, size_t A1, typename I, size_t C2, size_t A2, size_t C3, size_t A3>
+void gather(const SVector<T, C1, A1>& source, const SVector<I, C2, A2>& indices, SVector<T, C3, A3>& destination)
+{
+#ifdef _DEBUG
+    for (size_t i = 0; i < indices.size(); i++)
+    {
+        if (static_cast<size_t>(indices.data()[i]) >= source.size())
+        {
+            throw std::out_of_range("ERROR: gather index " + std::to_string(indices.data()[i]) + " is larger than size " + std::to_string(source.size()));
+        }
+    }
+#endif // _DEBUG end
+    destination.resizeForOverwrite(indices.size());
+    permutationKernels::gather(source.data(), indices.data(), indices.size(), destination.data());
+}
+/**
+ * @brief Writes source[i] to destination[indices[i]] for every i, destination keeps its size
+ * 
+ * @tparam T 
+ * @tparam I integer index type
+ * @param source 
+ * @param indices as many as source has elements, every index less than destination.size()
+ * @param destination different SVector from source
+ */
+template<typename T, size_t C1, size_t A1, typename I, size_t C2, size_t A2, size_t C3, size_t A3>
+void scatter(const SVector<T, C1, A1>& source, const SVector<I, C2, A2>& indices, SVector<T, C3, A3>& destination)
+{
+#ifdef _DEBUG
+    if (indices.size() != source.size())
+    {
+        throw std::out_of_range("ERROR: scatter has " + std::to_string(indices.size()) + " indices for " + std::to_string(source.size()) + " elements");
+    }
+    for (size_t i = 0; i < indices.size(); i++)
+    {
+        if (static_cast<size_t>(indices.data()[i]) >= destination.size())
+        {
+            throw std::out_of_range("ERROR: scatter index " + std::to_string(indices.data()[i]) + " is larger than size " + std::to_string(destination.size()));
+        }
+    }
+#endif // _DEBUG end
+    permutationKernels::scatter(source.data(), indices.data(), indices.size(), destination.data());
+}
+
+/**
+ * @brief Reorders every SVector in place so element i becomes the element that was at permutation[i], the order
+ * gather would produce. Each cycle of the permutation is followed once, moving every element once per SVector,
+ * and the only scratch space is a visited bitset of N bits.
+ * 
+ * @tparam I integer index type
+ * @tparam N capacity of permutation
+ * @tparam VECS SVectors of permutation.size() elements
+ * @param permutation every index below size exactly once
+ * @param vecs 
+ */
+template<typename I, size_t N, size_t A, typename... VECS>
+void permuteTogether(const SVector<I, N, A>& permutation, VECS&... vecs)
+{
+    size_t size = permutation.size();
+#ifdef _DEBUG
+    if (((vecs.size() != size) || ...))
+    {
+        throw std::out_of_range("ERROR: permutation size " + std::to_string(size) + " does not match every SVector");
+    }
+    std::bitset<N> seen;
+    for (size_t i = 0; i < size; i++)
+    {
+        size_t index = static_cast<size_t>(permutation.data()[i]);
+        if (index >= size || seen[index])
+        {
+            throw std::out_of_range("ERROR: index " + std::to_string(index) + " makes this not a permutation of size " + std::to_string(size));
+        }
+        seen[index] = true;
+    }
+#endif // _DEBUG end
+    const I* target = permutation.data();
+    std::bitset<N> visited;
+    for (size_t start = 0; start < size; start++)
+    {
+        if (visited[start] || static_cast<size_t>(target[start]) == start)
+        {
+            continue;
+        }
+        // the element at start is held aside, then every position in the cycle pulls in its source until
+        // the cycle closes back on start
+        auto held = std::make_tuple(std::move(vecs.data()[start])...);
+        size_t position = start;
+        while (true)
+        {
+            visited[position] = true;
+            size_t source = static_cast<size_t>(target[position]);
+            if (source == start)
+            {
+                std::apply([&](auto&... values) { ((vecs.data()[position] = std::move(values)), ...); }, held);
+                break;
+            }
+            ((vecs.data()[position] = std::move(vecs.data()[source])), ...);
+            position = source;
+        }
+    }
+}
+/**
+ * @brief Reorders vec in place so element i becomes the element that was at permutation[i], see permuteTogether
+ * 
+ * @tparam T 
+ * @tparam I integer index type
+ * @param vec 
+ * @param permutation every index below vec.size() exactly once
+ */
+template<typename T, size_t C, size_t A1, typename I, size_t N, size_t A2>
+inline void applyPermutation(SVector<T, C, A1>& vec, const SVector<I, N, A2>& permutation)
+{
+    permuteTogether(permutation, vec);
+}
+
+}
+
+#endif // SVEC_SPERMUTATION END
@@ -0,0 +1,494 @@
+// Copyright 2025 Dalton Prokosch
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SVEC_SPOLY_VECTOR
+#define SVEC_SPOLY_VECTOR
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+#include "sVector.hpp"
+
+namespace svec
+{
+
+/**
+ * @brief Vector of objects derived from Base stored on the stack in one byte buffer. Every element is emplaced in place
+ * behind a small header naming its type's relocation and destruction functions, a compact offset table points at the
+ * Base subobject of each element so iterating walks contiguous memory without a pointer chase or an allocation.
+ * Destroying an element calls its derived destructor, so Base does not need a virtual destructor.
+ * 
+ * @tparam Base common base class, iterated as Base&
+ * @tparam BYTES size of the element buffer including headers and padding
+ * @tparam MAX_ELEMENTS max amount of elements
+ */
+template<typename Base, size_t BYTES, size_t MAX_ELEMENTS = BYTES / (2 * sizeof(void*))>
+class SPolyVector
+{
+public:
+    /**
+     * @brief Smallest unsigned type that can hold BYTES, used for the offset table
+     * 
+     */
+    using OffsetType = std::conditional_t<BYTES <= UINT16_MAX, uint16_t,
+                       std::conditional_t<BYTES <= UINT32_MAX, uint32_t, size_t>>;
+
+    /**
+     * @brief Forward iterator over elements as Base&
+     * 
+     * @tparam ELEMENT Base or const Base
+     * @tparam CONTAINER SPolyVector or const SPolyVector
+     */
+    template<typename ELEMENT, typename CONTAINER>
+    class BasicIterator
+    {
+    public:
+        /**
+         * @brief Construct a new BasicIterator object
+         * 
+         * @param container
+         * @param index
+         */
+        BasicIterator(CONTAINER* container, size_t index) :
+            m_container(container),
+            m_index(index)
+        {}
+        /**
+         * @brief Moves to next element
+         * 
+         * @return BasicIterator&
+         */
+        BasicIterator& operator++()
+        {
+            m_index++;
+            return *this;
+        }
+        /**
+         * @brief Moves to next element
+         * 
+         * @return BasicIterator
+         */
+        BasicIterator operator++(int)
+        {
+            BasicIterator iterator = *this;
+            ++(*this);
+            return iterator;
+        }
+        /**
+         * @brief Accesses element
+         * 
+         * @return ELEMENT&
+         */
+        ELEMENT& operator*() const
+        {
+            return (*m_container)[m_index];
+        }
+        /**
+         * @brief Accesses element
+         * 
+         * @return ELEMENT*
+         */
+        ELEMENT* operator->() const
+        {
+            return &(*m_container)[m_index];
+        }
+        /**
+         * @brief Checks if both iterators point at the same element
+         * 
+         * @param other
+         * @return bool
+         */
+        bool operator==(const BasicIterator& other) const
+        {
+            return m_index == other.m_index;
+        }
+
+    private:
+        CONTAINER* m_container;
+        size_t m_index;
+    };
+    using Iterator = BasicIterator<Base, SPolyVector>;
+    using ConstIterator = BasicIterator<const Base, const SPolyVector>;
+
+    /**
+     * @brief Construct a new empty SPolyVector object
+     * 
+     */
+    SPolyVector() :
+        m_used{0}
+    {
+
+    }
+    SPolyVector(const SPolyVector&) = delete;
+    SPolyVector& operator=(const SPolyVector&) = delete;
+    /**
+     * @brief Relocates elements of other into this SPolyVector, other is left empty
+     * 
+     * @param other
+     */
+    SPolyVector(SPolyVector&& other) :
+        m_used{0}
+    {
+        relocateFrom(other);
+    }
+    /**
+     * @brief Destroys current elements and relocates elements of other into this SPolyVector, other is left empty
+     * 
+     * @param other
+     * @return SPolyVector&
+     */
+    SPolyVector& operator=(SPolyVector&& other)
+    {
+        if (this != &other)
+        {
+            clear();
+            relocateFrom(other);
+        }
+        return *this;
+    }
+    /**
+     * @brief Destroys elements
+     * 
+     */
+    ~SPolyVector()
+    {
+        clear();
+    }
+
+    /**
+     * @brief Constructs a DERIVED in place at the back
+     * 
+     * @tparam DERIVED type derived from Base
+     * @tparam ARGS
+     * @param args
+     * @return DERIVED& emplaced element
+     */
+    template<typename DERIVED, typename... ARGS>
+    DERIVED& emplaceBack(ARGS&&... args)
+    {
+        DERIVED* element = tryEmplaceBack<DERIVED>(std::forward<ARGS>(args)...);
+    #ifdef _DEBUG
+        if (!element)
+        {
+            throw std::out_of_range("ERROR: no room for element of " + std::to_string(sizeof(DERIVED)) + " bytes, "
+                + std::to_string(BYTES - m_used) + " bytes and " + std::to_string(MAX_ELEMENTS - m_slots.size()) + " elements left");
+        }
+    #endif // _DEBUG end
+        return *element;
+    }
+    /**
+     * @brief Constructs a DERIVED in place at the back if there is room
+     * 
+     * @tparam DERIVED type derived from Base
+     * @tparam ARGS
+     * @param args
+     * @return DERIVED* emplaced element, nullptr if the buffer or offset table is full
+     */
+    template<typename DERIVED, typename... ARGS>
+    DERIVED* tryEmplaceBack(ARGS&&... args)
+    {
+        static_assert(std::is_base_of_v<Base, DERIVED>, "SPolyVector elements have to derive from Base");
+        static_assert(alignof(DERIVED) <= BUFFER_ALIGNMENT, "SPolyVector element is over aligned");
+        static_assert(std::is_move_constructible_v<DERIVED>, "SPolyVector elements have to be move constructible to be relocated");
+
+        size_t header = alignUp(m_used, alignof(Header));
+        size_t object = alignUp(header + sizeof(Header), alignof(DERIVED));
+        if (object + sizeof(DERIVED) > BYTES || m_slots.size() == MAX_ELEMENTS)
+        {
+            return nullptr;
+        }
+        DERIVED* element = std::construct_at(reinterpret_cast<DERIVED*>(m_buffer + object), std::forward<ARGS>(args)...);
+        std::construct_at(reinterpret_cast<Header*>(m_buffer + header), Header{&operationsOf<DERIVED>});
+        size_t base = reinterpret_cast<std::byte*>(static_cast<Base*>(element)) - m_buffer;
+        m_slots.uncheckedPushBack(Slot{static_cast<OffsetType>(base), static_cast<OffsetType>(header)});
+        m_used = object + sizeof(DERIVED);
+        return element;
+    }
+    /**
+     * @brief Destroys element at the back
+     * 
+     */
+    inline void popBack()
+    {
+        const Slot& slot = m_slots.back();
+        header(slot)->operations->destroy(m_buffer + objectOffset(slot));
+        m_used = slot.header;
+        m_slots.popBack();
+    }
+    /**
+     * @brief Destroys element at index and relocates every later element down to keep the buffer packed
+     * 
+     * @param index
+     */
+    void erase(size_t index)
+    {
+        const Slot& erased = m_slots[index];
+        header(erased)->operations->destroy(m_buffer + objectOffset(erased));
+
+        m_used = erased.header;
+        for (size_t i = index + 1; i < m_slots.size(); i++)
+        {
+            m_slots[i - 1] = relocate(*this, m_slots[i]);
+        }
+        m_slots.popBack();
+    }
+    /**
+     * @brief Destroys every element
+     * 
+     */
+    inline void clear()
+    {
+        while (m_slots.size() > 0)
+        {
+            popBack();
+        }
+    }
+
+    /**
+     * @brief Accesses element
+     * 
+     * @param i
+     * @return Base&
+     */
+    inline Base& operator[](size_t i)
+    {
+        return *std::launder(reinterpret_cast<Base*>(m_buffer + m_slots[i].base));
+    }
+    /**
+     * @brief Accesses element
+     * 
+     * @param i
+     * @return const Base&
+     */
+    inline const Base& operator[](size_t i) const
+    {
+        return *std::launder(reinterpret_cast<const Base*>(m_buffer + m_slots[i].base));
+    }
+    /**
+     * @brief Returns iterator to first element
+     * 
+     * @return Iterator
+     */
+    inline Iterator begin()
+    {
+        return Iterator(this, 0);
+    }
+    /**
+     * @brief Returns iterator to first element
+     * 
+     * @return ConstIterator
+     */
+    inline ConstIterator begin() const
+    {
+        return ConstIterator(this, 0);
+    }
+    /**
+     * @brief Returns iterator past last element
+     * 
+     * @return Iterator
+     */
+    inline Iterator end()
+    {
+        return Iterator(this, m_slots.size());
+    }
+    /**
+     * @brief Returns iterator past last element
+     * 
+     * @return ConstIterator
+     */
+    inline ConstIterator end() const
+    {
+        return ConstIterator(this, m_slots.size());
+    }
+    /**
+     * @brief Returns amount of elements
+     * 
+     * @return size_t
+     */
+    inline size_t size() const
+    {
+        return m_slots.size();
+    }
+    /**
+     * @brief Returns amount of buffer bytes used by elements, headers and padding
+     * 
+     * @return size_t
+     */
+    inline size_t bytesUsed() const
+    {
+        return m_used;
+    }
+    /**
+     * @brief Returns size of the element buffer
+     * 
+     * @return size_t
+     */
+    inline size_t capacity() const
+    {
+        return BYTES;
+    }
+
+private:
+    /**
+     * @brief Type specific functions and layout of an element
+     * 
+     */
+    struct Operations
+    {
+        void (*destroy)(std::byte* object);
+        void (*relocate)(std::byte* from, std::byte* to);
+        size_t size;
+        size_t alignment;
+    };
+    /**
+     * @brief Stored in the buffer in front of every element
+     * 
+     */
+    struct Header
+    {
+        const Operations* operations;
+    };
+    /**
+     * @brief Offset table entry
+     * 
+     */
+    struct Slot
+    {
+        OffsetType base;
+        OffsetType header;
+    };
+
+    /**
+     * @brief Alignment of the buffer, elements can not be aligned stricter than this
+     * 
+     */
+    static constexpr size_t BUFFER_ALIGNMENT = CACHE_LINE_SIZE;
+
+    /**
+     * @brief Operations of DERIVED, one instance per type
+     * 
+     * @tparam DERIVED
+     */
+    template<typename DERIVED>
+    static inline const Operations operationsOf =
+    {
+        [](std::byte* object)
+        {
+            std::destroy_at(std::launder(reinterpret_cast<DERIVED*>(object)));
+        },
+        [](std::byte* from, std::byte* to)
+        {
+            DERIVED* source = std::launder(reinterpret_cast<DERIVED*>(from));
+            if (to + sizeof(DERIVED) > from && from + sizeof(DERIVED) > to)
+            {
+                // Overlapping slots, go through a temporary
+                DERIVED temporary(std::move(*source));
+                std::destroy_at(source);
+                std::construct_at(reinterpret_cast<DERIVED*>(to), std::move(temporary));
+                return;
+            }
+            std::construct_at(reinterpret_cast<DERIVED*>(to), std::move(*source));
+            std::destroy_at(source);
+        },
+        sizeof(DERIVED),
+        alignof(DERIVED)
+    };
+
+    /**
+     * @brief Rounds offset up to a multiple of alignment
+     * 
+     * @param offset
+     * @param alignment power of two
+     * @return size_t
+     */
+    static constexpr size_t alignUp(size_t offset, size_t alignment)
+    {
+        return (offset + alignment - 1) & ~(alignment - 1);
+    }
+    /**
+     * @brief Returns header of the element in slot
+     * 
+     * @param slot
+     * @return const Header*
+     */
+    inline const Header* header(const Slot& slot) const
+    {
+        return std::launder(reinterpret_cast<const Header*>(m_buffer + slot.header));
+    }
+    /**
+     * @brief Returns offset of the element in slot, the first suitably aligned byte after its header
+     * 
+     * @param slot
+     * @return size_t
+     */
+    inline size_t objectOffset(const Slot& slot) const
+    {
+        return alignUp(slot.header + sizeof(Header), header(slot)->operations->alignment);
+    }
+    /**
+     * @brief Moves element in slot of source to the end of the used bytes of this buffer, source may be this SPolyVector
+     * 
+     * @param source
+     * @param slot
+     * @return Slot new slot of the element
+     */
+    Slot relocate(SPolyVector& source, const Slot& slot)
+    {
+        const Operations* operations = source.header(slot)->operations;
+        size_t from = source.objectOffset(slot);
+        size_t headerOffset = alignUp(m_used, alignof(Header));
+        size_t object = alignUp(headerOffset + sizeof(Header), operations->alignment);
+        operations->relocate(source.m_buffer + from, m_buffer + object);
+        std::construct_at(reinterpret_cast<Header*>(m_buffer + headerOffset), Header{operations});
+        m_used = object + operations->size;
+        return Slot{static_cast<OffsetType>(object + (slot.base - from)), static_cast<OffsetType>(headerOffset)};
+    }
+    /**
+     * @brief Relocates every element of other to the back of this SPolyVector and empties other
+     * 
+     * @param other
+     */
+    void relocateFrom(SPolyVector& other)
+    {
+        for (const Slot& slot : other.m_slots)
+        {
+            m_slots.uncheckedPushBack(relocate(other, slot));
+        }
+        other.m_slots.clear();
+        other.m_used = 0;
+    }
+
+    /**
+     * @brief Elements and their headers, packed in emplacement order
+     * 
+     */
+    alignas(BUFFER_ALIGNMENT) std::byte m_buffer[BYTES];
+    /**
+     * @brief Where the Base subobject and the header of every element are in the buffer
+     * 
+     */
+    SVector<Slot, MAX_ELEMENTS> m_slots;
+    /**
+     * @brief Bytes of the buffer in use
+     * 
+     */
+    size_t m_used;
+};
+
+}
+
+#endif // SVEC_SPOLY_VECTOR END
@@ -0,0 +1,216 @@
+// Copyright 2025 Dalton Prokosch
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SVEC_SRADIX_SORT
+#define SVEC_SRADIX_SORT
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+#include "sVector.hpp"
+
+namespace svec
+{
+
+/**
+ * @brief Least significant digit radix sort passes. Keys are mapped to unsigned integers that order the same way,
+ * every digit histogram is counted in one read of the input and digits every element shares are skipped.
+ * 
+ */
+namespace radix
+{
+
+/**
+ * @brief Below this size per 4 bytes of key radixSort uses an insertion sort, clearing and scanning a histogram per
+ * key byte costs more than it saves
+ * 
+ */
+constexpr size_t SMALL_SORT_SIZE = 64;
+/**
+ * @brief From this size radixSort uses 11 bit digits, 3 passes instead of 4 for 32 bit keys and 6 instead of 8 for
+ * 64 bit keys. Below it the input stays in cache, where scattering into 2048 buckets costs more than the pass it saves.
+ * 
+ */
+constexpr size_t WIDE_DIGIT_SIZE = 1 << 16;
+
+/**
+ * @brief Maps key to an unsigned integer of the same size with the same order. Signed keys get their sign bit flipped,
+ * negative floating point keys get every bit flipped and positive ones their sign bit, so -0.0 sorts before 0.0
+ * and NaNs sort after infinity, or before negative infinity when their sign bit is set.
+ * 
+ * @tparam K arithmetic key type
+ * @param key
+ * @return unsigned integer of sizeof(K) bytes
+ */
+template<typename K>
+inline auto toUnsigned(K key)
+{
+    static_assert(std::is_arithmetic_v<K> && !std::is_same_v<K, bool> && sizeof(K) <= 8, "radix sort keys have to be integers, float or double");
+    if constexpr (std::is_floating_point_v<K>)
+    {
+        using U = std::conditional_t<sizeof(K) == 4, uint32_t, uint64_t>;
+        U bits = std::bit_cast<U>(key);
+        constexpr U SIGN = U{1} << (sizeof(U) * 8 - 1);
+        return (bits & SIGN) ? static_cast<U>(~bits) : static_cast<U>(bits | SIGN);
+    }
+    else if constexpr (std::is_signed_v<K>)
+    {
+        using U = std::make_unsigned_t<K>;
+        return static_cast<U>(static_cast<U>(key) ^ (U{1} << (sizeof(U) * 8 - 1)));
+    }
+    else
+    {
+        return key;
+    }
+}
+
+/**
+ * @brief Stable insertion sort by mapped key, for inputs below SMALL_SORT_SIZE
+ * 
+ * @tparam T
+ * @tparam KEY
+ * @param data
+ * @param size
+ * @param key
+ */
+template<typename T, typename KEY>
+void insertionSort(T* data, size_t size, KEY& key)
+{
+    for (size_t i = 1; i < size; i++)
+    {
+        auto bits = toUnsigned(key(data[i]));
+        if (!(bits < toUnsigned(key(data[i - 1]))))
+        {
+            continue;
+        }
+        T element = std::move(data[i]);
+        size_t position = i;
+        do
+        {
+            data[position] = std::move(data[position - 1]);
+            position--;
+        } while (position > 0 && bits < toUnsigned(key(data[position - 1])));
+        data[position] = std::move(element);
+    }
+}
+
+/**
+ * @brief Sorts size elements with DIGIT_BITS wide digits, moving them between data and scratch once per digit
+ * 
+ * @tparam DIGIT_BITS
+ * @tparam COUNT integer type that can hold size
+ * @tparam T
+ * @tparam KEY
+ * @param data
+ * @param scratch holds size elements
+ * @param size
+ * @param key
+ * @return true sorted elements ended up in scratch
+ * @return false sorted elements are in data
+ */
+template<size_t DIGIT_BITS, typename COUNT, typename T, typename KEY>
+bool sortPasses(T* data, T* scratch, size_t size, KEY& key)
+{
+    using U = decltype(toUnsigned(key(*data)));
+    constexpr size_t PASSES = (sizeof(U) * 8 + DIGIT_BITS - 1) / DIGIT_BITS;
+    constexpr size_t RADIX = size_t{1} << DIGIT_BITS;
+    constexpr size_t MASK = RADIX - 1;
+
+    COUNT counts[PASSES][RADIX] = {};
+    for (size_t i = 0; i < size; i++)
+    {
+        U bits = toUnsigned(key(data[i]));
+        for (size_t pass = 0; pass < PASSES; pass++)
+        {
+            counts[pass][(bits >> (pass * DIGIT_BITS)) & MASK]++;
+        }
+    }
+
+    T* from = data;
+    T* to = scratch;
+    for (size_t pass = 0; pass < PASSES; pass++)
+    {
+        size_t shift = pass * DIGIT_BITS;
+        COUNT* offsets = counts[pass];
+        if (offsets[(toUnsigned(key(from[0])) >> shift) & MASK] == size)
+        {
+            continue;
+        }
+        COUNT offset = 0;
+        for (size_t digit = 0; digit < RADIX; digit++)
+        {
+            COUNT count = offsets[digit];
+            offsets[digit] = offset;
+            offset += count;
+        }
+        for (size_t i = 0; i < size; i++)
+        {
+            to[offsets[(toUnsigned(key(from[i])) >> shift) & MASK]++] = std::move(from[i]);
+        }
+        std::swap(from, to);
+    }
+    return from != data;
+}
+
+}
+
+/**
+ * @brief Stable sort by an integer or floating point key using a least significant digit radix sort with a scratch
+ * SVector of the same capacity on the stack. Small inputs, see radix::SMALL_SORT_SIZE, use std::sort when the elements
+ * are their own keys and an insertion sort otherwise. Larger ones use 8 bit digits, and from radix::WIDE_DIGIT_SIZE
+ * keys wider than 16 bits use 11 bit digits. Floating point keys order as described in radix::toUnsigned.
+ * 
+ * @tparam T default constructible and move assignable
+ * @tparam KEY callable returning an arithmetic key for a const T&, the element itself by default
+ * @param vec 
+ * @param key called several times per element so it should be a cheap projection
+ */
+template<typename T, size_t C, size_t A, typename KEY = std::identity>
+void radixSort(SVector<T, C, A>& vec, KEY key = {})
+{
+    using Key = decltype(radix::toUnsigned(key(std::declval<const T&>())));
+    size_t size = vec.size();
+    if (size < radix::SMALL_SORT_SIZE * sizeof(Key) / 4)
+    {
+        if constexpr (std::is_arithmetic_v<T> && std::is_same_v<KEY, std::identity>)
+        {
+            // equal mapped keys are equal bits here so stability can not be observed
+            std::sort(vec.data(), vec.data() + size, [](T a, T b) { return radix::toUnsigned(a) < radix::toUnsigned(b); });
+        }
+        else
+        {
+            radix::insertionSort(vec.data(), size, key);
+        }
+        return;
+    }
+
+    using Count = std::conditional_t<C <= UINT32_MAX, uint32_t, size_t>;
+    SVector<T, C, A> scratch;
+    scratch.resizeForOverwrite(size);
+    bool inScratch = sizeof(Key) <= 2 || size < radix::WIDE_DIGIT_SIZE ?
+                     radix::sortPasses<8, Count>(vec.data(), scratch.data(), size, key) :
+                     radix::sortPasses<11, Count>(vec.data(), scratch.data(), size, key);
+    if (inScratch)
+    {
+        std::move(scratch.data(), scratch.data() + size, vec.data());
+    }
+}
+
+}
+
+#endif // SVEC_SRADIX_SORT END
@@ -0,0 +1,406 @@
+// Copyright 2025 Dalton Prokosch
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SVEC_SRECORD_BUFFER
+#define SVEC_SRECORD_BUFFER
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <span>
+
+#include "sVector.hpp"
+
+namespace svec
+{
+
+/**
+ * @brief Buffer of variable size records stored on the stack, meant for framing batches of messages.
+ * Every record is a native endian uint32_t payload size padded to ALIGNMENT followed by the payload padded to ALIGNMENT,
+ * so every header and payload starts aligned and records are read without unaligned loads. The bytes of the
+ * unconsumed records are what gets sent, received bytes are appended as is and only complete records are iterated.
+ * 
+ * @tparam BYTES max amount of bytes
+ * @tparam ALIGNMENT alignment of every header and payload
+ */
+template<size_t BYTES, size_t ALIGNMENT = 8>
+class SRecordBuffer
+{
+    static_assert(ALIGNMENT >= alignof(uint32_t) && (ALIGNMENT & (ALIGNMENT - 1)) == 0, "SRecordBuffer alignment has to be a power of two of at least 4");
+    static_assert(BYTES <= UINT32_MAX, "SRecordBuffer sizes are stored as uint32_t");
+public:
+    /**
+     * @brief Bytes taken by a header
+     * 
+     */
+    static constexpr size_t HEADER_BYTES = ALIGNMENT;
+
+    /**
+     * @brief Forward iterator over the payloads of complete records
+     * 
+     */
+    class ConstIterator
+    {
+    public:
+        typedef std::span<const std::byte> value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const value_type* pointer;
+        typedef value_type reference;
+        typedef std::forward_iterator_tag iterator_category;
+
+        /**
+         * @brief Construct a new ConstIterator object not pointing into any buffer
+         * 
+         */
+        ConstIterator() :
+            m_record(nullptr)
+        {}
+        /**
+         * @brief Construct a new ConstIterator object
+         * 
+         * @param record header of a record in a SRecordBuffer
+         */
+        explicit ConstIterator(const std::byte* record) :
+            m_record(record)
+        {}
+        /**
+         * @brief Moves to the next record
+         * 
+         * @return ConstIterator&
+         */
+        ConstIterator& operator++()
+        {
+            m_record += recordBytes(payloadSize(m_record));
+            return *this;
+        }
+        /**
+         * @brief Moves to the next record
+         * 
+         * @return ConstIterator
+         */
+        ConstIterator operator++(int)
+        {
+            ConstIterator iterator = *this;
+            ++(*this);
+            return iterator;
+        }
+        /**
+         * @brief Returns payload of record
+         * 
+         * @return std::span<const std::byte>
+         */
+        std::span<const std::byte> operator*() const
+        {
+            return std::span<const std::byte>(m_record + HEADER_BYTES, payloadSize(m_record));
+        }
+        /**
+         * @brief Checks if iterators are at the same record
+         * 
+         * @param other 
+         * @return true 
+         * @return false 
+         */
+        bool operator==(const ConstIterator& other) const
+        {
+            return m_record == other.m_record;
+        }
+        /**
+         * @brief Checks if iterators are at different records
+         * 
+         * @param other 
+         * @return true 
+         * @return false 
+         */
+        bool operator!=(const ConstIterator& other) const
+        {
+            return m_record != other.m_record;
+        }
+    private:
+        /**
+         * @brief Header of current record
+         * 
+         */
+        const std::byte* m_record;
+    };
+
+    /**
+     * @brief Construct a new empty SRecordBuffer object
+     * 
+     */
+    SRecordBuffer() = default;
+
+    /**
+     * @brief Returns bytes a record with payloadBytes of payload takes, header and padding included
+     * 
+     * @param payloadBytes
+     * @return size_t
+     */
+    static constexpr size_t recordBytes(size_t payloadBytes)
+    {
+        return HEADER_BYTES + ((payloadBytes + ALIGNMENT - 1) & ~(ALIGNMENT - 1));
+    }
+
+    /**
+     * @brief Appends a record holding a copy of payload
+     * 
+     * @param payload
+     * @return true record was appended
+     * @return false not enough room
+     */
+    bool append(std::span<const std::byte> payload)
+    {
+        std::span<std::byte> destination = prepare(payload.size());
+        if (destination.data() == nullptr)
+        {
+            return false;
+        }
+        if (!payload.empty())
+        {
+            memcpy(destination.data(), payload.data(), payload.size());
+        }
+        commit(payload.size());
+        return true;
+    }
+    /**
+     * @brief Reserves room for a record of up to maxBytes so its payload can be written in place, commit appends it.
+     * Other records can not be appended in between, nor while appendBytes left a partial record.
+     * 
+     * @param maxBytes
+     * @return std::span<std::byte> maxBytes of aligned payload space, with a null data pointer when there is not enough room
+     */
+    std::span<std::byte> prepare(size_t maxBytes)
+    {
+    #ifdef _DEBUG
+        if (m_complete != m_bytes.size())
+        {
+            throw std::out_of_range("ERROR: can not append a record after the partial record of appendBytes");
+        }
+    #endif // _DEBUG end
+        size_t end = m_bytes.size();
+        if (recordBytes(maxBytes) > BYTES - end)
+        {
+            return std::span<std::byte>();
+        }
+        m_prepared = maxBytes;
+        return std::span<std::byte>(m_bytes.data() + end + HEADER_BYTES, maxBytes);
+    }
+    /**
+     * @brief Appends the record reserved by the last prepare, holding the first bytes written to its payload
+     * 
+     * @param bytes at most the maxBytes given to prepare
+     */
+    void commit(size_t bytes)
+    {
+    #ifdef _DEBUG
+        if (bytes > m_prepared)
+        {
+            throw std::out_of_range("ERROR: committed " + std::to_string(bytes) + " bytes but prepared " + std::to_string(m_prepared));
+        }
+    #endif // _DEBUG end
+        size_t end = m_bytes.size();
+        m_bytes.resizeForOverwrite(end + recordBytes(bytes));
+        std::byte* record = m_bytes.data() + end;
+        uint32_t size = static_cast<uint32_t>(bytes);
+        memcpy(record, &size, sizeof(size));
+        // padding is zeroed so sent batches never carry stale bytes
+        memset(record + sizeof(size), 0, HEADER_BYTES - sizeof(size));
+        memset(record + HEADER_BYTES + bytes, 0, recordBytes(bytes) - HEADER_BYTES - bytes);
+        m_complete = m_bytes.size();
+        m_prepared = 0;
+    }
+    /**
+     * @brief Appends bytes of records framed by another SRecordBuffer with the same ALIGNMENT, for example read from a socket.
+     * A record split across calls becomes readable once its last byte was appended.
+     * 
+     * @param bytes
+     * @return true bytes were appended
+     * @return false not enough room, compact may make some
+     */
+    bool appendBytes(std::span<const std::byte> bytes)
+    {
+        size_t end = m_bytes.size();
+        if (bytes.size() > BYTES - end)
+        {
+            return false;
+        }
+        m_bytes.resizeForOverwrite(end + bytes.size());
+        if (!bytes.empty())
+        {
+            memcpy(m_bytes.data() + end, bytes.data(), bytes.size());
+        }
+        while (m_bytes.size() - m_complete >= HEADER_BYTES)
+        {
+            size_t next = recordBytes(payloadSize(m_bytes.data() + m_complete));
+            if (next > m_bytes.size() - m_complete)
+            {
+                break;
+            }
+            m_complete += next;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Returns payload of first unconsumed record
+     * 
+     * @return std::span<const std::byte>
+     */
+    inline std::span<const std::byte> front() const
+    {
+    #ifdef _DEBUG
+        if (empty())
+        {
+            throw std::out_of_range("ERROR: front called on SRecordBuffer without complete records");
+        }
+    #endif // _DEBUG end
+        return *begin();
+    }
+    /**
+     * @brief Consumes first record, its bytes are reused once compact is called
+     * 
+     */
+    inline void popFront()
+    {
+    #ifdef _DEBUG
+        if (empty())
+        {
+            throw std::out_of_range("ERROR: popFront called on SRecordBuffer without complete records");
+        }
+    #endif // _DEBUG end
+        m_consumed += recordBytes(payloadSize(m_bytes.data() + m_consumed));
+    }
+    /**
+     * @brief Drops consumed records by moving unconsumed bytes, partial records included, to the front
+     * 
+     */
+    void compact()
+    {
+        if (m_consumed == 0)
+        {
+            return;
+        }
+        size_t remaining = m_bytes.size() - m_consumed;
+        memmove(m_bytes.data(), m_bytes.data() + m_consumed, remaining);
+        m_bytes.resizeForOverwrite(remaining);
+        m_complete -= m_consumed;
+        m_consumed = 0;
+    }
+    /**
+     * @brief Removes every record and byte
+     * 
+     */
+    inline void clear()
+    {
+        m_bytes.clear();
+        m_consumed = 0;
+        m_complete = 0;
+        m_prepared = 0;
+    }
+
+    /**
+     * @brief Returns unconsumed bytes, the framed records to send
+     * 
+     * @return std::span<const std::byte>
+     */
+    inline std::span<const std::byte> bytes() const
+    {
+        return std::span<const std::byte>(m_bytes.data() + m_consumed, m_bytes.size() - m_consumed);
+    }
+    /**
+     * @brief Returns iterator at first unconsumed complete record
+     * 
+     * @return ConstIterator
+     */
+    inline ConstIterator begin() const
+    {
+        return ConstIterator(m_bytes.data() + m_consumed);
+    }
+    /**
+     * @brief Returns iterator past last complete record
+     * 
+     * @return ConstIterator
+     */
+    inline ConstIterator end() const
+    {
+        return ConstIterator(m_bytes.data() + m_complete);
+    }
+    /**
+     * @brief Checks if there is no unconsumed complete record
+     * 
+     * @return true
+     * @return false
+     */
+    inline bool empty() const
+    {
+        return m_consumed == m_complete;
+    }
+    /**
+     * @brief Returns amount of unconsumed bytes
+     * 
+     * @return size_t
+     */
+    inline size_t size() const
+    {
+        return m_bytes.size() - m_consumed;
+    }
+    /**
+     * @brief Returns max amount of bytes
+     * 
+     * @return size_t
+     */
+    inline size_t capacity() const
+    {
+        return BYTES;
+    }
+
+private:
+    /**
+     * @brief Reads payload size from a header
+     * 
+     * @param record
+     * @return size_t
+     */
+    static inline size_t payloadSize(const std::byte* record)
+    {
+        uint32_t size;
+        memcpy(&size, std::assume_aligned<ALIGNMENT>(record), sizeof(size));
+        return size;
+    }
+
+    /**
+     * @brief Records, consumed ones first and possibly a partial one last
+     * 
+     */
+    SVector<std::byte, BYTES, ALIGNMENT> m_bytes;
+    /**
+     * @brief Offset of first unconsumed record
+     * 
+     */
+    size_t m_consumed = 0;
+    /**
+     * @brief Offset past last complete record
+     * 
+     */
+    size_t m_complete = 0;
+    /**
+     * @brief Payload bytes reserved by the last prepare
+     * 
+     */
+    size_t m_prepared = 0;
+};
+
+}
+
+#endif // SVEC_SRECORD_BUFFER END
@@ -0,0 +1,299 @@
+// Copyright 2025 Dalton Prokosch
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SVEC_SSEQLOCK_VECTOR
+#define SVEC_SSEQLOCK_VECTOR
+
+#include <atomic>
+#include <cstdint>
+#include <span>
+
+#include "sVector.hpp"
+
+namespace svec
+{
+
+/**
+ * @brief Fixed capacity vector published by one writer thread to any amount of reader threads through a sequence lock.
+ * The writer makes the sequence odd, updates elements in place and makes it even again. Readers copy a snapshot into
+ * their own SVector and retry if the sequence was odd or changed, so the read side never writes shared memory and
+ * readers never contend with each other.
+ * Elements are stored as relaxed atomic words so a torn read is a retry rather than a data race.
+ * 
+ * @tparam T trivially copyable type stored in container
+ * @tparam CAPACITY max amount of elements
+ */
+template<typename T, size_t CAPACITY>
+class SSeqlockVector
+{
+    static_assert(std::is_trivially_copyable_v<T>, "SSeqlockVector requires a trivially copyable type");
+
+    using Word = uint64_t;
+    static constexpr size_t WORDS = (CAPACITY * sizeof(T) + sizeof(Word) - 1) / sizeof(Word);
+public:
+    /**
+     * @brief Construct a new empty SSeqlockVector object
+     * 
+     */
+    SSeqlockVector()
+    {
+        for (std::atomic<Word>& word : m_words)
+        {
+            word.store(0, std::memory_order_relaxed);
+        }
+    }
+    SSeqlockVector(const SSeqlockVector&) = delete;
+    SSeqlockVector& operator=(const SSeqlockVector&) = delete;
+
+    /**
+     * @brief Copies a consistent snapshot into out, retrying while the writer is mid update. Safe from any thread.
+     * 
+     * @tparam A alignment of out
+     * @param out
+     */
+    template<size_t A>
+    void load(SVector<T, CAPACITY, A>& out) const
+    {
+        while (true)
+        {
+            uint64_t before = m_sequence.load(std::memory_order_acquire);
+            if (before & 1)
+            {
+                pause();
+                continue;
+            }
+            size_t size = m_size.load(std::memory_order_relaxed);
+            out.resizeForOverwrite(size);
+            readBytes(reinterpret_cast<unsigned char*>(out.data()), size * sizeof(T));
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (m_sequence.load(std::memory_order_relaxed) == before)
+            {
+                return;
+            }
+        }
+    }
+    /**
+     * @brief Returns a consistent snapshot. Safe from any thread.
+     * 
+     * @return SVector<T, CAPACITY>
+     */
+    SVector<T, CAPACITY> load() const
+    {
+        SVector<T, CAPACITY> out;
+        load(out);
+        return out;
+    }
+    /**
+     * @brief Returns amount of times the writer has published, readers can skip loads when it has not changed
+     * 
+     * @return uint64_t
+     */
+    inline uint64_t version() const
+    {
+        return m_sequence.load(std::memory_order_acquire) / 2;
+    }
+    /**
+     * @brief Returns size of array
+     * 
+     * @return size_t
+     */
+    inline size_t capacity() const
+    {
+        return CAPACITY;
+    }
+
+    /**
+     * @brief Replaces every element. Writer thread only.
+     * 
+     * @param elements
+     */
+    void store(std::span<const T> elements)
+    {
+    #ifdef _DEBUG
+        if (elements.size() > CAPACITY)
+        {
+            throw std::out_of_range("ERROR: size " + std::to_string(elements.size()) + " is larger than capacity " + std::to_string(CAPACITY));
+        }
+    #endif // _DEBUG end
+        uint64_t sequence = beginWrite();
+        writeBytes(0, reinterpret_cast<const unsigned char*>(elements.data()), elements.size() * sizeof(T));
+        m_size.store(elements.size(), std::memory_order_relaxed);
+        endWrite(sequence);
+    }
+    /**
+     * @brief Replaces every element. Writer thread only.
+     * 
+     * @tparam C capacity of elements
+     * @tparam A alignment of elements
+     * @param elements
+     */
+    template<size_t C, size_t A>
+    void store(const SVector<T, C, A>& elements)
+    {
+        static_assert(C <= CAPACITY, "SVector capacity is larger than SSeqlockVector capacity");
+        store(std::span<const T>(elements.data(), elements.size()));
+    }
+    /**
+     * @brief Replaces element at index in place. Writer thread only.
+     * 
+     * @param index
+     * @param element
+     */
+    void set(size_t index, const T& element)
+    {
+    #ifdef _DEBUG
+        size_t size = m_size.load(std::memory_order_relaxed);
+        if (index >= size)
+        {
+            throw std::out_of_range("ERROR: index " + std::to_string(index) + " is larger than size " + std::to_string(size));
+        }
+    #endif // _DEBUG end
+        uint64_t sequence = beginWrite();
+        writeBytes(index * sizeof(T), reinterpret_cast<const unsigned char*>(&element), sizeof(T));
+        endWrite(sequence);
+    }
+    /**
+     * @brief Adds element to back. Writer thread only.
+     * 
+     * @param element
+     */
+    void pushBack(const T& element)
+    {
+        size_t size = m_size.load(std::memory_order_relaxed);
+    #ifdef _DEBUG
+        if (size >= CAPACITY)
+        {
+            throw std::out_of_range("ERROR: can not add element, SSeqlockVector is at capacity " + std::to_string(CAPACITY));
+        }
+    #endif // _DEBUG end
+        uint64_t sequence = beginWrite();
+        writeBytes(size * sizeof(T), reinterpret_cast<const unsigned char*>(&element), sizeof(T));
+        m_size.store(size + 1, std::memory_order_relaxed);
+        endWrite(sequence);
+    }
+    /**
+     * @brief Removes element from back. Writer thread only.
+     * 
+     */
+    void popBack()
+    {
+        size_t size = m_size.load(std::memory_order_relaxed);
+    #ifdef _DEBUG
+        if (size == 0)
+        {
+            throw std::out_of_range("ERROR: can not remove element, SSeqlockVector is empty");
+        }
+    #endif // _DEBUG end
+        uint64_t sequence = beginWrite();
+        m_size.store(size - 1, std::memory_order_relaxed);
+        endWrite(sequence);
+    }
+    /**
+     * @brief Removes every element. Writer thread only.
+     * 
+     */
+    void clear()
+    {
+        uint64_t sequence = beginWrite();
+        m_size.store(0, std::memory_order_relaxed);
+        endWrite(sequence);
+    }
+
+private:
+    /**
+     * @brief Makes sequence odd so readers retry
+     * 
+     * @return uint64_t even sequence before the write
+     */
+    inline uint64_t beginWrite()
+    {
+        uint64_t sequence = m_sequence.load(std::memory_order_relaxed);
+        m_sequence.store(sequence + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        return sequence;
+    }
+    /**
+     * @brief Makes sequence even again, publishing the write
+     * 
+     * @param sequence value returned by beginWrite
+     */
+    inline void endWrite(uint64_t sequence)
+    {
+        m_sequence.store(sequence + 2, std::memory_order_release);
+    }
+    /**
+     * @brief Copies bytes into words starting at byte offset, merging with the bytes already in partially covered words
+     * 
+     * @param offset
+     * @param source
+     * @param count
+     */
+    void writeBytes(size_t offset, const unsigned char* source, size_t count)
+    {
+        size_t end = offset + count;
+        for (size_t i = offset / sizeof(Word); i * sizeof(Word) < end; i++)
+        {
+            size_t wordStart = i * sizeof(Word);
+            size_t low = std::max(offset, wordStart);
+            size_t high = std::min(end, wordStart + sizeof(Word));
+            Word word = m_words[i].load(std::memory_order_relaxed);
+            memcpy(reinterpret_cast<unsigned char*>(&word) + (low - wordStart), source + (low - offset), high - low);
+            m_words[i].store(word, std::memory_order_relaxed);
+        }
+    }
+    /**
+     * @brief Copies the first count bytes of the words into destination
+     * 
+     * @param destination
+     * @param count
+     */
+    void readBytes(unsigned char* destination, size_t count) const
+    {
+        for (size_t i = 0; i * sizeof(Word) < count; i++)
+        {
+            Word word = m_words[i].load(std::memory_order_relaxed);
+            memcpy(destination + i * sizeof(Word), &word, std::min(sizeof(Word), count - i * sizeof(Word)));
+        }
+    }
+    /**
+     * @brief Hints the CPU that this is a spin loop
+     * 
+     */
+    static inline void pause()
+    {
+    #if defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+    #endif
+    }
+
+    /**
+     * @brief Odd while the writer is updating, incremented twice per write
+     * 
+     */
+    alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> m_sequence{0};
+    /**
+     * @brief Amount of elements
+     * 
+     */
+    std::atomic<size_t> m_size{0};
+    /**
+     * @brief Bytes of the elements
+     * 
+     */
+    std::atomic<Word> m_words[WORDS];
+};
+
+}
+
+#endif // SVEC_SSEQLOCK_VECTOR END
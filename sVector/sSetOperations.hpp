@@ -0,0 +1,406 @@
+// Copyright 2025 Dalton Prokosch
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SVEC_SSET_OPERATIONS
+#define SVEC_SSET_OPERATIONS
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include "sVector.hpp"
+
+namespace svec
+{
+
+/**
+ * @brief Kernels behind the set operations, working on sorted arrays of integers without duplicates.
+ * When one input is much smaller than the other each of its elements is found in the larger one by galloping,
+ * otherwise 32 bit keys are compared 4 by 4 with SSE2 and everything else (and the tails) goes through a branchless merge.
+ * Output pointers have to have room for the worst case and must not alias an input.
+ * 
+ */
+namespace setKernels
+{
+
+/**
+ * @brief Size ratio above which the smaller input gallops through the larger one instead of merging
+ * 
+ */
+inline constexpr size_t GALLOP_RATIO = 32;
+
+/**
+ * @brief Finds first index at or after begin whose element is not less than key, probing 1, 2, 4, ... elements ahead
+ * and binary searching the last step, so finding a key d elements ahead costs O(log d)
+ * 
+ * @tparam T
+ * @param data sorted elements
+ * @param begin
+ * @param size
+ * @param key
+ * @return size_t index or size
+ */
+template<typename T>
+inline size_t gallop(const T* data, size_t begin, size_t size, T key)
+{
+    size_t step = 1;
+    while (begin + step < size && data[begin + step] < key)
+    {
+        step *= 2;
+    }
+    return std::lower_bound(data + begin + step / 2, data + std::min(begin + step + 1, size), key) - data;
+}
+
+#ifdef __SSE2__
+/**
+ * @brief Compares every lane of a with every lane of b by rotating b three times
+ * 
+ * @param a
+ * @param b
+ * @return int bit i is set when lane i of a equals any lane of b
+ */
+inline int matchMask(__m128i a, __m128i b)
+{
+    __m128i rotated1 = _mm_shuffle_epi32(b, _MM_SHUFFLE(0, 3, 2, 1));
+    __m128i rotated2 = _mm_shuffle_epi32(b, _MM_SHUFFLE(1, 0, 3, 2));
+    __m128i rotated3 = _mm_shuffle_epi32(b, _MM_SHUFFLE(2, 1, 0, 3));
+    __m128i equal = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi32(a, b), _mm_cmpeq_epi32(a, rotated1)),
+                                 _mm_or_si128(_mm_cmpeq_epi32(a, rotated2), _mm_cmpeq_epi32(a, rotated3)));
+    return _mm_movemask_ps(_mm_castsi128_ps(equal));
+}
+#endif // __SSE2__ end
+
+/**
+ * @brief Keeps elements of a 4 element block whose bit is set in mask. Every lane is stored and the cursor only
+ * moves past kept ones, so there is no branch per element but out needs room for as many elements as precede
+ * each lane in block's array.
+ * 
+ * @tparam T
+ * @param block
+ * @param mask
+ * @param out
+ * @return size_t amount kept
+ */
+template<typename T>
+inline size_t writeMasked(const T* block, int mask, T* out)
+{
+    size_t count = 0;
+    for (int lane = 0; lane < 4; lane++)
+    {
+        out[count] = block[lane];
+        count += (mask >> lane) & 1;
+    }
+    return count;
+}
+
+/**
+ * @brief Intersects a and b
+ * 
+ * @tparam WRITE write matches to out, otherwise only count them
+ * @tparam T
+ * @param a
+ * @param aSize
+ * @param b
+ * @param bSize
+ * @param out room for min(aSize, bSize) elements, unused when WRITE is false
+ * @return size_t amount of common elements
+ */
+template<bool WRITE, typename T>
+size_t intersect(const T* a, size_t aSize, const T* b, size_t bSize, T* out)
+{
+    if (aSize > bSize)
+    {
+        std::swap(a, b);
+        std::swap(aSize, bSize);
+    }
+    size_t count = 0;
+    if (aSize * GALLOP_RATIO < bSize)
+    {
+        size_t j = 0;
+        for (size_t i = 0; i < aSize && j < bSize; i++)
+        {
+            j = gallop(b, j, bSize, a[i]);
+            if (j < bSize && b[j] == a[i])
+            {
+                if constexpr (WRITE)
+                {
+                    out[count] = a[i];
+                }
+                count++;
+                j++;
+            }
+        }
+        return count;
+    }
+
+    size_t i = 0;
+    size_t j = 0;
+#ifdef __SSE2__
+    if constexpr (sizeof(T) == 4)
+    {
+        while (i + 4 <= aSize && j + 4 <= bSize)
+        {
+            int mask = matchMask(_mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i)),
+                                 _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + j)));
+            if constexpr (WRITE)
+            {
+                count += writeMasked(a + i, mask, out + count);
+            }
+            else
+            {
+                count += __builtin_popcount(mask);
+            }
+            T aLast = a[i + 3];
+            T bLast = b[j + 3];
+            i += (aLast <= bLast) * 4;
+            j += (bLast <= aLast) * 4;
+        }
+    }
+#endif // __SSE2__ end
+    while (i < aSize && j < bSize)
+    {
+        T x = a[i];
+        T y = b[j];
+        if constexpr (WRITE)
+        {
+            out[count] = x;
+        }
+        count += x == y;
+        i += x <= y;
+        j += y <= x;
+    }
+    return count;
+}
+
+/**
+ * @brief Writes elements of a that are not in b
+ * 
+ * @tparam T
+ * @param a
+ * @param aSize
+ * @param b
+ * @param bSize
+ * @param out room for aSize elements
+ * @return size_t amount written
+ */
+template<typename T>
+size_t difference(const T* a, size_t aSize, const T* b, size_t bSize, T* out)
+{
+    size_t count = 0;
+    if (aSize * GALLOP_RATIO < bSize)
+    {
+        size_t j = 0;
+        for (size_t i = 0; i < aSize; i++)
+        {
+            j = gallop(b, j, bSize, a[i]);
+            if (j == bSize || b[j] != a[i])
+            {
+                out[count++] = a[i];
+            }
+        }
+        return count;
+    }
+
+    size_t i = 0;
+    size_t j = 0;
+    // lanes of the current block of a already matched against earlier blocks of b
+    int found = 0;
+#ifdef __SSE2__
+    if constexpr (sizeof(T) == 4)
+    {
+        while (i + 4 <= aSize && j + 4 <= bSize)
+        {
+            found |= matchMask(_mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i)),
+                               _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + j)));
+            T aLast = a[i + 3];
+            T bLast = b[j + 3];
+            if (aLast <= bLast)
+            {
+                count += writeMasked(a + i, ~found & 0xF, out + count);
+                found = 0;
+                i += 4;
+            }
+            j += (bLast <= aLast) * 4;
+        }
+    }
+#endif // __SSE2__ end
+    size_t blockStart = i;
+    while (i < aSize && j < bSize)
+    {
+        T x = a[i];
+        T y = b[j];
+        bool known = i - blockStart < 4 && ((found >> (i - blockStart)) & 1);
+        out[count] = x;
+        count += x < y && !known;
+        i += x <= y;
+        j += y <= x;
+    }
+    for (; i < aSize; i++)
+    {
+        if (!(i - blockStart < 4 && ((found >> (i - blockStart)) & 1)))
+        {
+            out[count++] = a[i];
+        }
+    }
+    return count;
+}
+
+/**
+ * @brief Writes elements that are in a, b or both
+ * 
+ * @tparam T
+ * @param a
+ * @param aSize
+ * @param b
+ * @param bSize
+ * @param out room for aSize + bSize elements
+ * @return size_t amount written
+ */
+template<typename T>
+size_t unite(const T* a, size_t aSize, const T* b, size_t bSize, T* out)
+{
+    if (aSize > bSize)
+    {
+        std::swap(a, b);
+        std::swap(aSize, bSize);
+    }
+    size_t count = 0;
+    if (aSize * GALLOP_RATIO < bSize)
+    {
+        // copies the runs of b between elements of a in bulk
+        size_t j = 0;
+        for (size_t i = 0; i < aSize; i++)
+        {
+            size_t next = gallop(b, j, bSize, a[i]);
+            out = std::copy(b + j, b + next, out);
+            *out++ = a[i];
+            count += next - j + 1;
+            j = next + (next < bSize && b[next] == a[i]);
+        }
+        std::copy(b + j, b + bSize, out);
+        return count + bSize - j;
+    }
+
+    size_t i = 0;
+    size_t j = 0;
+    while (i < aSize && j < bSize)
+    {
+        T x = a[i];
+        T y = b[j];
+        out[count++] = x < y ? x : y;
+        i += x <= y;
+        j += y <= x;
+    }
+    out = std::copy(a + i, a + aSize, out + count);
+    std::copy(b + j, b + bSize, out);
+    return count + (aSize - i) + (bSize - j);
+}
+
+}
+
+/**
+ * @brief Replaces out with the elements found in both a and b.
+ * Inputs have to be sorted without duplicates and out must be a different SVector.
+ * 
+ * @tparam T integer type
+ * @param a
+ * @param b
+ * @param out throws std::length_error up front when it can not hold min(a.size(), b.size()) elements
+ */
+template<typename T, size_t C1, size_t A1, size_t C2, size_t A2, size_t C3, size_t A3>
+void intersect(const SVector<T, C1, A1>& a, const SVector<T, C2, A2>& b, SVector<T, C3, A3>& out)
+{
+    static_assert(std::is_integral_v<T>, "intersect requires an integer type");
+#ifdef _DEBUG
+    if (static_cast<const void*>(&out) == &a || static_cast<const void*>(&out) == &b)
+    {
+        throw std::invalid_argument("ERROR: intersect can not write into one of its inputs");
+    }
+#endif // _DEBUG end
+    size_t worst = std::min(a.size(), b.size());
+    out.reserve(worst);
+    out.resizeForOverwrite(worst);
+    out.resizeForOverwrite(setKernels::intersect<true>(a.data(), a.size(), b.data(), b.size(), out.data()));
+}
+/**
+ * @brief Counts elements found in both a and b without writing them anywhere.
+ * Inputs have to be sorted without duplicates.
+ * 
+ * @tparam T integer type
+ * @param a
+ * @param b
+ * @return size_t
+ */
+template<typename T, size_t C1, size_t A1, size_t C2, size_t A2>
+size_t intersectCount(const SVector<T, C1, A1>& a, const SVector<T, C2, A2>& b)
+{
+    static_assert(std::is_integral_v<T>, "intersectCount requires an integer type");
+    return setKernels::intersect<false, T>(a.data(), a.size(), b.data(), b.size(), nullptr);
+}
+/**
+ * @brief Replaces out with the elements found in a, b or both.
+ * Inputs have to be sorted without duplicates and out must be a different SVector.
+ * 
+ * @tparam T integer type
+ * @param a
+ * @param b
+ * @param out throws std::length_error up front when it can not hold a.size() + b.size() elements
+ */
+template<typename T, size_t C1, size_t A1, size_t C2, size_t A2, size_t C3, size_t A3>
+void unite(const SVector<T, C1, A1>& a, const SVector<T, C2, A2>& b, SVector<T, C3, A3>& out)
+{
+    static_assert(std::is_integral_v<T>, "unite requires an integer type");
+#ifdef _DEBUG
+    if (static_cast<const void*>(&out) == &a || static_cast<const void*>(&out) == &b)
+    {
+        throw std::invalid_argument("ERROR: unite can not write into one of its inputs");
+    }
+#endif // _DEBUG end
+    size_t worst = a.size() + b.size();
+    out.reserve(worst);
+    out.resizeForOverwrite(worst);
+    out.resizeForOverwrite(setKernels::unite(a.data(), a.size(), b.data(), b.size(), out.data()));
+}
+/**
+ * @brief Replaces out with the elements of a that are not in b.
+ * Inputs have to be sorted without duplicates and out must be a different SVector.
+ * 
+ * @tparam T integer type
+ * @param a
+ * @param b
+ * @param out throws std::length_error up front when it can not hold a.size() elements
+ */
+template<typename T, size_t C1, size_t A1, size_t C2, size_t A2, size_t C3, size_t A3>
+void difference(const SVector<T, C1, A1>& a, const SVector<T, C2, A2>& b, SVector<T, C3, A3>& out)
+{
+    static_assert(std::is_integral_v<T>, "difference requires an integer type");
+#ifdef _DEBUG
+    if (static_cast<const void*>(&out) == &a || static_cast<const void*>(&out) == &b)
+    {
+        throw std::invalid_argument("ERROR: difference can not write into one of its inputs");
+    }
+#endif // _DEBUG end
+    out.reserve(a.size());
+    out.resizeForOverwrite(a.size());
+    out.resizeForOverwrite(setKernels::difference(a.data(), a.size(), b.data(), b.size(), out.data()));
+}
+
+}
+
+#endif // SVEC_SSET_OPERATIONS END
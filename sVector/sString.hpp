@@ -0,0 +1,716 @@
+// Copyright 2025 Dalton Prokosch
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SVEC_SSTRING
+#define SVEC_SSTRING
+
+#include <compare>
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <string_view>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include "sVector.hpp"
+
+#if defined(__GNUC__) || defined(__clang__)
+#define SVEC_PRINTF_FORMAT(FORMAT_INDEX, FIRST_ARG_INDEX) __attribute__((format(printf, FORMAT_INDEX, FIRST_ARG_INDEX)))
+#else
+#define SVEC_PRINTF_FORMAT(FORMAT_INDEX, FIRST_ARG_INDEX)
+#endif
+
+namespace svec
+{
+
+/**
+ * @brief Search kernels used by SString. Each one uses 16 byte SSE2 blocks when available and
+ * finishes the tail (or everything when SSE2 is unavailable) with a scalar loop, so no load ever reads past size.
+ * 
+ */
+namespace stringSearch
+{
+
+/**
+ * @brief Value returned when nothing was found
+ * 
+ */
+inline constexpr size_t npos = SIZE_MAX;
+
+/**
+ * @brief Finds first occurrence of c in data starting at pos
+ * 
+ * @param data
+ * @param size
+ * @param pos
+ * @param c
+ * @return size_t index or npos
+ */
+inline size_t findChar(const char* data, size_t size, size_t pos, char c)
+{
+    size_t i = pos;
+#ifdef __SSE2__
+    const __m128i needle = _mm_set1_epi8(c);
+    for (; i + 16 <= size; i += 16)
+    {
+        __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        int mask = _mm_movemask_epi8(_mm_cmpeq_epi8(block, needle));
+        if (mask != 0)
+        {
+            return i + __builtin_ctz(mask);
+        }
+    }
+#endif // __SSE2__ end
+    for (; i < size; i++)
+    {
+        if (data[i] == c)
+        {
+            return i;
+        }
+    }
+    return npos;
+}
+
+/**
+ * @brief Finds first occurrence of needle in data starting at pos.
+ * Candidates are filtered by comparing the first and last character of needle 16 positions at a time.
+ * 
+ * @param data
+ * @param size
+ * @param pos
+ * @param needle
+ * @return size_t index or npos
+ */
+inline size_t find(const char* data, size_t size, size_t pos, std::string_view needle)
+{
+    if (needle.size() == 0)
+    {
+        return pos <= size ? pos : npos;
+    }
+    if (needle.size() == 1)
+    {
+        return findChar(data, size, pos, needle[0]);
+    }
+    if (needle.size() > size)
+    {
+        return npos;
+    }
+    const size_t last = needle.size() - 1;
+    const size_t end = size - last;
+    size_t i = pos;
+#ifdef __SSE2__
+    const __m128i first = _mm_set1_epi8(needle.front());
+    const __m128i back = _mm_set1_epi8(needle.back());
+    for (; i + 16 <= end; i += 16)
+    {
+        __m128i blockFirst = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        __m128i blockLast = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i + last));
+        int mask = _mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(blockFirst, first), _mm_cmpeq_epi8(blockLast, back)));
+        while (mask != 0)
+        {
+            size_t candidate = i + __builtin_ctz(mask);
+            if (memcmp(data + candidate + 1, needle.data() + 1, last - 1) == 0)
+            {
+                return candidate;
+            }
+            mask &= mask - 1;
+        }
+    }
+#endif // __SSE2__ end
+    for (; i < end; i++)
+    {
+        if (data[i] == needle.front() && memcmp(data + i + 1, needle.data() + 1, last) == 0)
+        {
+            return i;
+        }
+    }
+    return npos;
+}
+
+/**
+ * @brief Finds first character in data starting at pos that is in set.
+ * Sets of up to 16 characters are compared 16 bytes at a time, larger sets use a 256 bit lookup table.
+ * 
+ * @param data
+ * @param size
+ * @param pos
+ * @param set
+ * @return size_t index or npos
+ */
+inline size_t findFirstOf(const char* data, size_t size, size_t pos, std::string_view set)
+{
+    size_t i = pos;
+    if (set.size() <= 16)
+    {
+    #ifdef __SSE2__
+        __m128i needles[16];
+        for (size_t j = 0; j < set.size(); j++)
+        {
+            needles[j] = _mm_set1_epi8(set[j]);
+        }
+        for (; i + 16 <= size; i += 16)
+        {
+            __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+            __m128i matches = _mm_setzero_si128();
+            for (size_t j = 0; j < set.size(); j++)
+            {
+                matches = _mm_or_si128(matches, _mm_cmpeq_epi8(block, needles[j]));
+            }
+            int mask = _mm_movemask_epi8(matches);
+            if (mask != 0)
+            {
+                return i + __builtin_ctz(mask);
+            }
+        }
+    #endif // __SSE2__ end
+        for (; i < size; i++)
+        {
+            if (memchr(set.data(), data[i], set.size()) != nullptr)
+            {
+                return i;
+            }
+        }
+        return npos;
+    }
+    uint64_t table[4] = {0, 0, 0, 0};
+    for (char c : set)
+    {
+        unsigned char u = static_cast<unsigned char>(c);
+        table[u >> 6] |= uint64_t{1} << (u & 63);
+    }
+    for (; i < size; i++)
+    {
+        unsigned char u = static_cast<unsigned char>(data[i]);
+        if (table[u >> 6] & (uint64_t{1} << (u & 63)))
+        {
+            return i;
+        }
+    }
+    return npos;
+}
+
+/**
+ * @brief Checks if two ASCII ranges of equal size are equal ignoring case
+ * 
+ * @param a
+ * @param b
+ * @param size
+ * @return true
+ * @return false
+ */
+inline bool equalsIgnoreCase(const char* a, const char* b, size_t size)
+{
+    size_t i = 0;
+#ifdef __SSE2__
+    const __m128i beforeA = _mm_set1_epi8('A' - 1);
+    const __m128i afterZ = _mm_set1_epi8('Z' + 1);
+    const __m128i caseBit = _mm_set1_epi8(0x20);
+    auto toLower = [&](__m128i block)
+    {
+        __m128i isUpper = _mm_and_si128(_mm_cmpgt_epi8(block, beforeA), _mm_cmplt_epi8(block, afterZ));
+        return _mm_or_si128(block, _mm_and_si128(isUpper, caseBit));
+    };
+    for (; i + 16 <= size; i += 16)
+    {
+        __m128i blockA = toLower(_mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i)));
+        __m128i blockB = toLower(_mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i)));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(blockA, blockB)) != 0xFFFF)
+        {
+            return false;
+        }
+    }
+#endif // __SSE2__ end
+    for (; i < size; i++)
+    {
+        char lowerA = (a[i] >= 'A' && a[i] <= 'Z') ? a[i] | 0x20 : a[i];
+        char lowerB = (b[i] >= 'A' && b[i] <= 'Z') ? b[i] | 0x20 : b[i];
+        if (lowerA != lowerB)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+}
+
+/**
+ * @brief Fixed capacity string stored on the stack. Always null terminated, size is stored in the
+ * smallest unsigned type that can hold CAPACITY.
+ * 
+ * @tparam CAPACITY max amount of characters, not including the null terminator
+ */
+template<size_t CAPACITY>
+class SString
+{
+public:
+    /**
+     * @brief Smallest unsigned type that can hold CAPACITY
+     * 
+     */
+    using SizeType = std::conditional_t<CAPACITY <= UINT8_MAX, uint8_t,
+                     std::conditional_t<CAPACITY <= UINT16_MAX, uint16_t, uint32_t>>;
+    /**
+     * @brief Value returned by searches when nothing was found
+     * 
+     */
+    static constexpr size_t npos = stringSearch::npos;
+
+    /**
+     * @brief Construct a new empty SString object
+     * 
+     */
+    SString() :
+        m_size{0}
+    {
+        m_data[0] = '\0';
+    }
+    /**
+     * @brief Construct a new SString object from a null terminated string
+     * 
+     * @param str
+     */
+    SString(const char* str) :
+        SString(std::string_view(str))
+    {
+
+    }
+    /**
+     * @brief Construct a new SString object from a string view
+     * 
+     * @param str
+     */
+    SString(std::string_view str) :
+        m_size{0}
+    {
+        append(str);
+    }
+    /**
+     * @brief Construct a new SString object from the characters of a SVector
+     * 
+     * @tparam C capacity of SVector
+     * @tparam A alignment of SVector
+     * @param vec
+     */
+    template<size_t C, size_t A>
+    explicit SString(const SVector<char, C, A>& vec) :
+        SString(std::string_view(vec.data(), vec.size()))
+    {
+
+    }
+
+    /**
+     * @brief Implicitly converts to std::string_view
+     * 
+     * @return std::string_view
+     */
+    inline operator std::string_view() const
+    {
+        return std::string_view(m_data, m_size);
+    }
+    /**
+     * @brief Copies into a heap allocated std::string
+     * 
+     * @return std::string
+     */
+    inline std::string str() const
+    {
+        return std::string(m_data, m_size);
+    }
+
+    /**
+     * @brief Returns iterator at start of string
+     * 
+     * @return char*
+     */
+    inline char* begin()
+    {
+        return m_data;
+    }
+    /**
+     * @brief Returns iterator at start of string
+     * 
+     * @return const char*
+     */
+    inline const char* begin() const
+    {
+        return m_data;
+    }
+    /**
+     * @brief Returns iterator at end of string
+     * 
+     * @return char*
+     */
+    inline char* end()
+    {
+        return m_data + m_size;
+    }
+    /**
+     * @brief Returns iterator at end of string
+     * 
+     * @return const char*
+     */
+    inline const char* end() const
+    {
+        return m_data + m_size;
+    }
+
+    /**
+     * @brief Accesses character of string
+     * 
+     * @param i
+     * @return char&
+     */
+    inline char& operator[](size_t i)
+    {
+    #ifdef _DEBUG
+        if (i >= m_size)
+        {
+            throw std::out_of_range("ERROR: index " + std::to_string(i) + " is larger than size " + std::to_string(m_size));
+        }
+    #endif // _DEBUG end
+        return m_data[i];
+    }
+    /**
+     * @brief Accesses character of string
+     * 
+     * @param i
+     * @return const char&
+     */
+    inline const char& operator[](size_t i) const
+    {
+    #ifdef _DEBUG
+        if (i >= m_size)
+        {
+            throw std::out_of_range("ERROR: index " + std::to_string(i) + " is larger than size " + std::to_string(m_size));
+        }
+    #endif // _DEBUG end
+        return m_data[i];
+    }
+    /**
+     * @brief Returns pointer to characters
+     * 
+     * @return char*
+     */
+    inline char* data()
+    {
+        return m_data;
+    }
+    /**
+     * @brief Returns pointer to characters
+     * 
+     * @return const char*
+     */
+    inline const char* data() const
+    {
+        return m_data;
+    }
+    /**
+     * @brief Returns null terminated string
+     * 
+     * @return const char*
+     */
+    inline const char* c_str() const
+    {
+        return m_data;
+    }
+    /**
+     * @brief Returns amount of characters in string
+     * 
+     * @return size_t
+     */
+    inline size_t size() const
+    {
+        return m_size;
+    }
+    /**
+     * @brief Returns max amount of characters string can hold
+     * 
+     * @return size_t
+     */
+    inline size_t capacity() const
+    {
+        return CAPACITY;
+    }
+    /**
+     * @brief Checks if string is empty
+     * 
+     * @return true
+     * @return false
+     */
+    inline bool empty() const
+    {
+        return m_size == 0;
+    }
+    /**
+     * @brief Returns last character
+     * 
+     * @return char&
+     */
+    inline char& back()
+    {
+        return m_data[m_size - 1];
+    }
+    /**
+     * @brief Returns last character
+     * 
+     * @return const char&
+     */
+    inline const char& back() const
+    {
+        return m_data[m_size - 1];
+    }
+    /**
+     * @brief Returns first character
+     * 
+     * @return char&
+     */
+    inline char& front()
+    {
+        return m_data[0];
+    }
+    /**
+     * @brief Returns first character
+     * 
+     * @return const char&
+     */
+    inline const char& front() const
+    {
+        return m_data[0];
+    }
+
+    /**
+     * @brief Removes all characters
+     * 
+     */
+    inline void clear()
+    {
+        m_size = 0;
+        m_data[0] = '\0';
+    }
+    /**
+     * @brief Adds character to back of string
+     * 
+     * @param c
+     */
+    inline void pushBack(char c)
+    {
+    #ifdef _DEBUG
+        checkFits(1);
+    #endif // _DEBUG end
+        m_data[m_size] = c;
+        m_size++;
+        m_data[m_size] = '\0';
+    }
+    /**
+     * @brief Removes character from back of string
+     * 
+     */
+    inline void popBack()
+    {
+        m_size--;
+        m_data[m_size] = '\0';
+    }
+    /**
+     * @brief Appends characters to back of string
+     * 
+     * @param str
+     * @return SString&
+     */
+    inline SString& append(std::string_view str)
+    {
+    #ifdef _DEBUG
+        checkFits(str.size());
+    #endif // _DEBUG end
+        memcpy(m_data + m_size, str.data(), str.size());
+        m_size += static_cast<SizeType>(str.size());
+        m_data[m_size] = '\0';
+        return *this;
+    }
+    /**
+     * @brief Appends characters to back of string
+     * 
+     * @param str
+     * @return SString&
+     */
+    inline SString& operator+=(std::string_view str)
+    {
+        return append(str);
+    }
+    /**
+     * @brief Appends character to back of string
+     * 
+     * @param c
+     * @return SString&
+     */
+    inline SString& operator+=(char c)
+    {
+        pushBack(c);
+        return *this;
+    }
+    /**
+     * @brief Appends printf style formatted output to back of string without allocating.
+     * Output that does not fit is truncated to capacity.
+     * 
+     * @param format printf style format
+     * @param ...
+     * @return true all output fit
+     * @return false output was truncated
+     */
+    SVEC_PRINTF_FORMAT(2, 3)
+    bool appendFormat(const char* format, ...)
+    {
+        size_t remaining = CAPACITY - m_size;
+        va_list args;
+        va_start(args, format);
+        int written = vsnprintf(m_data + m_size, remaining + 1, format, args);
+        va_end(args);
+        if (written < 0)
+        {
+            m_data[m_size] = '\0';
+            return false;
+        }
+        bool fits = static_cast<size_t>(written) <= remaining;
+        m_size += static_cast<SizeType>(fits ? written : remaining);
+        return fits;
+    }
+
+    /**
+     * @brief Finds first occurrence of c starting at pos
+     * 
+     * @param c
+     * @param pos
+     * @return size_t index or npos
+     */
+    inline size_t find(char c, size_t pos = 0) const
+    {
+        return stringSearch::findChar(m_data, m_size, pos, c);
+    }
+    /**
+     * @brief Finds first occurrence of str starting at pos
+     * 
+     * @param str
+     * @param pos
+     * @return size_t index or npos
+     */
+    inline size_t find(std::string_view str, size_t pos = 0) const
+    {
+        return stringSearch::find(m_data, m_size, pos, str);
+    }
+    /**
+     * @brief Finds first character that is in set starting at pos
+     * 
+     * @param set
+     * @param pos
+     * @return size_t index or npos
+     */
+    inline size_t findFirstOf(std::string_view set, size_t pos = 0) const
+    {
+        return stringSearch::findFirstOf(m_data, m_size, pos, set);
+    }
+    /**
+     * @brief Lexicographically compares string to str. Uses memcmp, which is vectorized by the C library.
+     * 
+     * @param str
+     * @return int negative if less than str, zero if equal, positive if greater than str
+     */
+    inline int compare(std::string_view str) const
+    {
+        int result = memcmp(m_data, str.data(), std::min<size_t>(m_size, str.size()));
+        if (result != 0)
+        {
+            return result;
+        }
+        return m_size < str.size() ? -1 : (m_size > str.size() ? 1 : 0);
+    }
+    /**
+     * @brief Checks if string is equal to str ignoring ASCII case
+     * 
+     * @param str
+     * @return true
+     * @return false
+     */
+    inline bool equalsIgnoreCase(std::string_view str) const
+    {
+        return m_size == str.size() && stringSearch::equalsIgnoreCase(m_data, str.data(), m_size);
+    }
+
+    /**
+     * @brief Checks if string is equal to str
+     * 
+     * @param str
+     * @return true
+     * @return false
+     */
+    inline bool operator==(std::string_view str) const
+    {
+        return m_size == str.size() && memcmp(m_data, str.data(), m_size) == 0;
+    }
+    /**
+     * @brief Lexicographically compares string to str
+     * 
+     * @param str
+     * @return std::strong_ordering
+     */
+    inline std::strong_ordering operator<=>(std::string_view str) const
+    {
+        return compare(str) <=> 0;
+    }
+
+private:
+    /**
+     * @brief Throws if amount characters can not be added to string
+     * 
+     * @param amount
+     */
+    inline void checkFits(size_t amount) const
+    {
+        if (amount > CAPACITY - m_size)
+        {
+            throw std::out_of_range("ERROR: size " + std::to_string(m_size + amount) + " is larger than capacity " + std::to_string(CAPACITY));
+        }
+    }
+
+    /**
+     * @brief Characters followed by null terminator
+     * 
+     */
+    char m_data[CAPACITY + 1];
+    /**
+     * @brief Amount of characters in string
+     * 
+     */
+    SizeType m_size;
+};
+
+/**
+ * @brief Prints SString
+ * 
+ * @tparam CAPACITY
+ * @param out
+ * @param obj
+ * @return std::ostream&
+ */
+template<size_t CAPACITY>
+std::ostream& operator<<(std::ostream& out, const SString<CAPACITY>& obj)
+{
+    return out << std::string_view(obj);
+}
+
+}
+
+#endif // SVEC_SSTRING END
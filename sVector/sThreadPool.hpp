@@ -0,0 +1,418 @@
+// Copyright 2025 Dalton Prokosch
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SVEC_STHREAD_POOL
+#define SVEC_STHREAD_POOL
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+
+#include "sVector.hpp"
+#include "sWorkStealingDeque.hpp"
+
+namespace svec
+{
+
+/**
+ * @brief Small fork-join thread pool built on SWorkStealingDeque. Every worker owns a deque of jobs, join pushes
+ * one side onto the calling worker's deque and runs the other inline, idle workers steal from the top of other deques.
+ * Jobs live on the stack of the thread that forked them, so nothing is allocated after construction.
+ * A full deque runs the forked side inline. Threads that are not workers hand jobs over through a small locked queue.
+ * Jobs must not throw.
+ */
+class SThreadPool
+{
+public:
+    /**
+     * @brief Max amount of pending jobs per worker
+     * 
+     */
+    static constexpr size_t DEQUE_CAPACITY = 1024;
+    /**
+     * @brief Max amount of pending jobs forked by threads outside of the pool
+     * 
+     */
+    static constexpr size_t INJECTION_CAPACITY = 256;
+
+    /**
+     * @brief Construct a new SThreadPool object and starts workers.
+     * Threads calling join help while they wait, so one less worker than cores keeps every core busy.
+     * 
+     * @param workers amount of worker threads
+     */
+    explicit SThreadPool(size_t workers = std::max(1u, std::thread::hardware_concurrency()) - 1) :
+        m_workers(std::make_unique<Worker[]>(workers)),
+        m_workerCount{workers}
+    {
+        for (size_t i = 0; i < m_workerCount; i++)
+        {
+            m_workers[i].thread = std::thread([this, i]() { workerLoop(&m_workers[i]); });
+        }
+    }
+    SThreadPool(const SThreadPool&) = delete;
+    SThreadPool& operator=(const SThreadPool&) = delete;
+    /**
+     * @brief Stops and joins workers, every join has to have returned
+     * 
+     */
+    ~SThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_sleepMutex);
+            m_stop.store(true);
+        }
+        m_sleepCondition.notify_all();
+        for (size_t i = 0; i < m_workerCount; i++)
+        {
+            m_workers[i].thread.join();
+        }
+    }
+
+    /**
+     * @brief Runs left and right, possibly in parallel, and returns once both are done.
+     * Right is offered to other threads while the caller runs left, then the caller helps with other jobs until right is done.
+     * 
+     * @tparam LEFT callable taking no arguments
+     * @tparam RIGHT callable taking no arguments
+     * @param left
+     * @param right
+     */
+    template<typename LEFT, typename RIGHT>
+    void join(LEFT&& left, RIGHT&& right)
+    {
+        FunctionJob<std::remove_reference_t<RIGHT>> job(right);
+        Worker* self = currentWorker();
+        if (!submit(self, &job))
+        {
+            left();
+            right();
+            return;
+        }
+        left();
+        while (!job.done())
+        {
+            Job* other = findJob(self);
+            if (other)
+            {
+                other->run();
+            }
+            else
+            {
+                std::this_thread::yield();
+            }
+        }
+    }
+    /**
+     * @brief Calls function(first, last) on chunks of [begin, end) no larger than grain, splitting recursively with join
+     * 
+     * @tparam FUNCTION callable taking (size_t first, size_t last)
+     * @param begin
+     * @param end
+     * @param grain largest chunk run without splitting, at least 1
+     * @param function
+     */
+    template<typename FUNCTION>
+    void parallelFor(size_t begin, size_t end, size_t grain, const FUNCTION& function)
+    {
+        if (end - begin <= std::max<size_t>(grain, 1))
+        {
+            if (begin < end)
+            {
+                function(begin, end);
+            }
+            return;
+        }
+        size_t middle = begin + (end - begin) / 2;
+        join([&]() { parallelFor(begin, middle, grain, function); },
+             [&]() { parallelFor(middle, end, grain, function); });
+    }
+    /**
+     * @brief Returns amount of worker threads
+     * 
+     * @return size_t
+     */
+    inline size_t workers() const
+    {
+        return m_workerCount;
+    }
+
+private:
+    /**
+     * @brief Type erased unit of work, lives on the stack of the thread that forked it until it is done
+     * 
+     */
+    class Job
+    {
+    public:
+        explicit Job(void (*execute)(Job*)) :
+            m_execute(execute)
+        {
+
+        }
+        /**
+         * @brief Runs job and marks it done, the job may be destroyed by its owner right after
+         * 
+         */
+        inline void run()
+        {
+            m_execute(this);
+            m_done.store(true, std::memory_order_release);
+        }
+        /**
+         * @brief Checks if job has finished running
+         * 
+         * @return true
+         * @return false
+         */
+        inline bool done() const
+        {
+            return m_done.load(std::memory_order_acquire);
+        }
+
+    private:
+        void (*m_execute)(Job*);
+        std::atomic<bool> m_done{false};
+    };
+    /**
+     * @brief Job calling a callable owned by the forking thread
+     * 
+     * @tparam FUNCTION callable taking no arguments
+     */
+    template<typename FUNCTION>
+    class FunctionJob : public Job
+    {
+    public:
+        explicit FunctionJob(FUNCTION& function) :
+            Job([](Job* job) { (*static_cast<FunctionJob*>(job)->m_function)(); }),
+            m_function(&function)
+        {
+
+        }
+
+    private:
+        FUNCTION* m_function;
+    };
+    /**
+     * @brief Deque and thread of a worker, padded so workers do not share cache lines
+     * 
+     */
+    struct alignas(CACHE_LINE_SIZE) Worker
+    {
+        SWorkStealingDeque<Job*, DEQUE_CAPACITY> deque;
+        std::thread thread;
+    };
+
+    /**
+     * @brief Returns worker of this pool running on the calling thread
+     * 
+     * @return Worker* nullptr if the calling thread is not a worker of this pool
+     */
+    inline Worker* currentWorker() const
+    {
+        return t_pool == this ? t_worker : nullptr;
+    }
+    /**
+     * @brief Offers job to other threads, through the worker's own deque or the injection queue
+     * 
+     * @param self
+     * @param job
+     * @return true job was handed over
+     * @return false no room, caller has to run it
+     */
+    bool submit(Worker* self, Job* job)
+    {
+        if (self)
+        {
+            if (!self->deque.push(job))
+            {
+                return false;
+            }
+        }
+        else
+        {
+            std::lock_guard<std::mutex> lock(m_injectionMutex);
+            if (!m_injected.tryPushBack(job))
+            {
+                return false;
+            }
+        }
+        // Pairs with the sequentially consistent increment of m_sleeping before a worker's last look for jobs
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (m_sleeping.load(std::memory_order_relaxed) > 0)
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_sleepMutex);
+                m_wakeups++;
+            }
+            m_sleepCondition.notify_one();
+        }
+        return true;
+    }
+    /**
+     * @brief Pops newest job of self, otherwise steals oldest job of another worker, otherwise takes an injected job
+     * 
+     * @param self worker of calling thread, nullptr for outside threads
+     * @return Job* nullptr if no job was found
+     */
+    Job* findJob(Worker* self)
+    {
+        if (self)
+        {
+            if (std::optional<Job*> job = self->deque.pop())
+            {
+                return *job;
+            }
+        }
+        if (m_workerCount > 0)
+        {
+            t_seed = t_seed * 6364136223846793005ull + 1442695040888963407ull;
+            size_t start = static_cast<size_t>(t_seed >> 33) % m_workerCount;
+            for (size_t i = 0; i < m_workerCount; i++)
+            {
+                Worker& victim = m_workers[(start + i) % m_workerCount];
+                if (&victim == self)
+                {
+                    continue;
+                }
+                if (std::optional<Job*> job = victim.deque.steal())
+                {
+                    return *job;
+                }
+            }
+        }
+        std::lock_guard<std::mutex> lock(m_injectionMutex);
+        if (m_injected.size() == 0)
+        {
+            return nullptr;
+        }
+        Job* job = m_injected.back();
+        m_injected.popBack();
+        return job;
+    }
+    /**
+     * @brief Runs jobs until the pool is destroyed, sleeps after spinning for a while without finding any
+     * 
+     * @param self
+     */
+    void workerLoop(Worker* self)
+    {
+        t_pool = this;
+        t_worker = self;
+        t_seed = reinterpret_cast<uintptr_t>(self);
+        size_t idle = 0;
+        while (!m_stop.load(std::memory_order_relaxed))
+        {
+            if (Job* job = findJob(self))
+            {
+                job->run();
+                idle = 0;
+                continue;
+            }
+            if (++idle < IDLE_SPINS)
+            {
+                std::this_thread::yield();
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(m_sleepMutex);
+            uint64_t wakeups = m_wakeups;
+            m_sleeping.fetch_add(1, std::memory_order_seq_cst);
+            Job* job = findJob(self);
+            if (!job)
+            {
+                m_sleepCondition.wait(lock, [&]() { return m_wakeups != wakeups || m_stop.load(); });
+            }
+            m_sleeping.fetch_sub(1, std::memory_order_relaxed);
+            lock.unlock();
+            if (job)
+            {
+                job->run();
+            }
+            idle = 0;
+        }
+    }
+
+    /**
+     * @brief Failed looks for jobs before a worker goes to sleep
+     * 
+     */
+    static constexpr size_t IDLE_SPINS = 64;
+
+    /**
+     * @brief Pool and worker running on this thread
+     * 
+     */
+    static inline thread_local const SThreadPool* t_pool = nullptr;
+    static inline thread_local Worker* t_worker = nullptr;
+    /**
+     * @brief State of this thread's victim picker
+     * 
+     */
+    static inline thread_local uint64_t t_seed = 0;
+
+    /**
+     * @brief Workers, allocated once at construction
+     * 
+     */
+    std::unique_ptr<Worker[]> m_workers;
+    /**
+     * @brief Amount of workers
+     * 
+     */
+    size_t m_workerCount;
+    /**
+     * @brief Guards m_injected
+     * 
+     */
+    std::mutex m_injectionMutex;
+    /**
+     * @brief Jobs forked by threads outside of the pool
+     * 
+     */
+    SVector<Job*, INJECTION_CAPACITY> m_injected;
+    /**
+     * @brief Guards m_wakeups, sleeping workers wait on it
+     * 
+     */
+    std::mutex m_sleepMutex;
+    /**
+     * @brief Wakes sleeping workers
+     * 
+     */
+    std::condition_variable m_sleepCondition;
+    /**
+     * @brief Incremented every time sleeping workers are woken for new jobs
+     * 
+     */
+    uint64_t m_wakeups = 0;
+    /**
+     * @brief Amount of workers about to sleep or sleeping
+     * 
+     */
+    std::atomic<size_t> m_sleeping{0};
+    /**
+     * @brief Workers exit once set
+     * 
+     */
+    std::atomic<bool> m_stop{false};
+};
+
+}
+
+#endif // SVEC_STHREAD_POOL END
@@ -0,0 +1,395 @@
+// Copyright 2025 Dalton Prokosch
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SVEC_STIMER_WHEEL
+#define SVEC_STIMER_WHEEL
+
+#include <bit>
+#include <cstdint>
+#include <span>
+
+#include "sVector.hpp"
+
+namespace svec
+{
+
+/**
+ * @brief Refers to a scheduled timer, goes stale once the timer fires or is cancelled
+ * 
+ */
+struct TimerHandle
+{
+    uint32_t index = UINT32_MAX;
+    uint32_t generation = 0;
+
+    /**
+     * @brief Checks if handle was returned by a successful schedule
+     * 
+     * @return true
+     * @return false
+     */
+    inline bool valid() const
+    {
+        return index != UINT32_MAX;
+    }
+};
+
+/**
+ * @brief Hierarchical timer wheel driven by a caller supplied tick, with every bucket an inline SVector of timer indices.
+ * Level l has SLOTS slots of SLOTS^l ticks each. A timer goes in the lowest level that spans its delay and is
+ * cascaded into a lower level once the wheel reaches the start of its slot, so it is moved at most LEVELS times.
+ * Timers live in a fixed pool and are referred to by index and generation, which makes schedule, cancel and
+ * reschedule O(1) and allocation free.
+ * 
+ * @tparam Payload value handed back when a timer fires
+ * @tparam SLOTS slots per level, power of two
+ * @tparam LEVELS amount of levels, the wheel spans SLOTS^LEVELS ticks in one rotation of the top level
+ * @tparam BUCKET_CAPACITY max amount of timers in one slot
+ * @tparam MAX_TIMERS max amount of pending timers
+ */
+template<typename Payload, size_t SLOTS, size_t LEVELS, size_t BUCKET_CAPACITY, size_t MAX_TIMERS = SLOTS * LEVELS * BUCKET_CAPACITY>
+class STimerWheel
+{
+    static_assert(SLOTS >= 2 && (SLOTS & (SLOTS - 1)) == 0, "STimerWheel requires a power of two amount of slots");
+    static_assert(LEVELS >= 1, "STimerWheel requires at least one level");
+    static_assert(MAX_TIMERS < UINT32_MAX, "STimerWheel indexes timers with 32 bits");
+public:
+    /**
+     * @brief Construct a new empty STimerWheel object
+     * 
+     * @param now tick the wheel starts at
+     */
+    explicit STimerWheel(uint64_t now = 0) :
+        m_now{now}
+    {
+
+    }
+    STimerWheel(const STimerWheel&) = delete;
+    STimerWheel& operator=(const STimerWheel&) = delete;
+
+    /**
+     * @brief Schedules payload to fire delay ticks from now, a delay of 0 fires on the next tick
+     * 
+     * @param delay
+     * @param payload
+     * @return TimerHandle invalid if the pool or the target bucket is full
+     */
+    TimerHandle schedule(uint64_t delay, Payload payload)
+    {
+        if (m_free == NONE && m_timers.size() == MAX_TIMERS)
+        {
+            return TimerHandle();
+        }
+        uint64_t deadline = m_now + std::max<uint64_t>(delay, 1);
+        uint32_t bucket = bucketOf(deadline);
+        if (m_buckets[bucket].size() == BUCKET_CAPACITY)
+        {
+            return TimerHandle();
+        }
+
+        uint32_t index;
+        if (m_free != NONE)
+        {
+            index = m_free;
+            m_free = m_timers[index].position;
+            m_timers[index].payload = std::move(payload);
+        }
+        else
+        {
+            index = static_cast<uint32_t>(m_timers.size());
+            m_timers.uncheckedEmplaceBack(Timer{std::move(payload), 0, 0, 0, 0});
+        }
+        Timer& timer = m_timers[index];
+        timer.deadline = deadline;
+        insert(index, bucket);
+        m_size++;
+        return TimerHandle{index, timer.generation};
+    }
+    /**
+     * @brief Cancels a pending timer
+     * 
+     * @param handle
+     * @return true timer was cancelled
+     * @return false timer already fired or was cancelled
+     */
+    bool cancel(TimerHandle handle)
+    {
+        if (!pending(handle))
+        {
+            return false;
+        }
+        remove(handle.index);
+        release(handle.index);
+        return true;
+    }
+    /**
+     * @brief Moves a pending timer to fire delay ticks from now, for example when a connection sees activity
+     * 
+     * @param handle
+     * @param delay
+     * @return true timer was moved
+     * @return false timer already fired or was cancelled, or the target bucket is full
+     */
+    bool reschedule(TimerHandle handle, uint64_t delay)
+    {
+        if (!pending(handle))
+        {
+            return false;
+        }
+        uint64_t deadline = m_now + std::max<uint64_t>(delay, 1);
+        uint32_t bucket = bucketOf(deadline);
+        if (bucket != m_timers[handle.index].bucket && m_buckets[bucket].size() == BUCKET_CAPACITY)
+        {
+            return false;
+        }
+        remove(handle.index);
+        m_timers[handle.index].deadline = deadline;
+        insert(handle.index, bucket);
+        return true;
+    }
+    /**
+     * @brief Checks if handle refers to a timer that has not fired or been cancelled
+     * 
+     * @param handle
+     * @return true
+     * @return false
+     */
+    inline bool pending(TimerHandle handle) const
+    {
+        return handle.index < m_timers.size() && m_timers[handle.index].generation == handle.generation
+            && m_timers[handle.index].bucket != NONE;
+    }
+
+    /**
+     * @brief Advances the wheel by one tick, cascading higher levels whose slot was reached
+     * 
+     * @return std::span<Payload> payloads of every timer that fired, valid until the next tick
+     */
+    std::span<Payload> tick()
+    {
+        m_now++;
+        m_fired.clear();
+        for (size_t level = LEVELS - 1; level > 0; level--)
+        {
+            if ((m_now & ((uint64_t(1) << (SLOT_BITS * level)) - 1)) == 0)
+            {
+                cascade(static_cast<uint32_t>(level * SLOTS + ((m_now >> (SLOT_BITS * level)) & SLOT_MASK)));
+            }
+        }
+
+        SVector<uint32_t, BUCKET_CAPACITY> due = std::move(m_buckets[m_now & SLOT_MASK]);
+        m_buckets[m_now & SLOT_MASK].clear();
+        for (uint32_t index : due)
+        {
+            if (m_timers[index].deadline > m_now)
+            {
+                // More than one rotation of the top level away
+                place(index, static_cast<uint32_t>(m_now & SLOT_MASK));
+                continue;
+            }
+            m_fired.uncheckedPushBack(std::move(m_timers[index].payload));
+            release(index);
+        }
+        return std::span<Payload>(m_fired.data(), m_fired.size());
+    }
+    /**
+     * @brief Returns current tick
+     * 
+     * @return uint64_t
+     */
+    inline uint64_t now() const
+    {
+        return m_now;
+    }
+    /**
+     * @brief Returns amount of pending timers
+     * 
+     * @return size_t
+     */
+    inline size_t size() const
+    {
+        return m_size;
+    }
+    /**
+     * @brief Returns max amount of pending timers
+     * 
+     * @return size_t
+     */
+    inline size_t capacity() const
+    {
+        return MAX_TIMERS;
+    }
+
+private:
+    static constexpr uint32_t NONE = UINT32_MAX;
+    static constexpr size_t SLOT_BITS = std::countr_zero(SLOTS);
+    static constexpr uint64_t SLOT_MASK = SLOTS - 1;
+
+    /**
+     * @brief Pending timer, or a free one linked through position
+     * 
+     */
+    struct Timer
+    {
+        Payload payload;
+        uint64_t deadline;
+        /**
+         * @brief Bucket holding the timer, NONE once fired or cancelled
+         * 
+         */
+        uint32_t bucket;
+        /**
+         * @brief Index in bucket while pending, next free timer while free
+         * 
+         */
+        uint32_t position;
+        /**
+         * @brief Incremented every time the timer is released so old handles go stale
+         * 
+         */
+        uint32_t generation;
+    };
+
+    /**
+     * @brief Returns bucket a deadline belongs in right now: the lowest level whose slots cover the remaining delay,
+     * or the top level if it is further out than one rotation. Choosing by delay rather than by which digits of the
+     * deadline differ from now keeps timers crossing a high level boundary from piling into one bucket.
+     * 
+     * @param deadline later than now
+     * @return uint32_t
+     */
+    inline uint32_t bucketOf(uint64_t deadline) const
+    {
+        uint64_t delay = deadline - m_now;
+        size_t level = 0;
+        while (level < LEVELS - 1 && delay >= (uint64_t(1) << (SLOT_BITS * (level + 1))))
+        {
+            level++;
+        }
+        return static_cast<uint32_t>(level * SLOTS + ((deadline >> (SLOT_BITS * level)) & SLOT_MASK));
+    }
+    /**
+     * @brief Appends timer to bucket
+     * 
+     * @param index
+     * @param bucket
+     */
+    inline void insert(uint32_t index, uint32_t bucket)
+    {
+        m_timers[index].bucket = bucket;
+        m_timers[index].position = static_cast<uint32_t>(m_buckets[bucket].size());
+        m_buckets[bucket].uncheckedPushBack(index);
+    }
+    /**
+     * @brief Removes timer from its bucket by moving the bucket's last timer into its place
+     * 
+     * @param index
+     */
+    inline void remove(uint32_t index)
+    {
+        Timer& timer = m_timers[index];
+        SVector<uint32_t, BUCKET_CAPACITY>& bucket = m_buckets[timer.bucket];
+        uint32_t last = bucket.back();
+        bucket[timer.position] = last;
+        m_timers[last].position = timer.position;
+        bucket.popBack();
+    }
+    /**
+     * @brief Returns timer to the free list
+     * 
+     * @param index
+     */
+    inline void release(uint32_t index)
+    {
+        Timer& timer = m_timers[index];
+        timer.bucket = NONE;
+        timer.generation++;
+        timer.position = m_free;
+        m_free = index;
+        m_size--;
+    }
+    /**
+     * @brief Puts timer in the bucket its deadline belongs in, the current level 0 slot that tick drains next if it
+     * is already due. A timer whose bucket is full is pushed back one slot of that level at a time until a bucket has
+     * room and fires late, so it never lands in a slot that is drained before its deadline.
+     * 
+     * @param index
+     * @param fallback bucket emptied by the caller, used once every bucket tried is full
+     */
+    void place(uint32_t index, uint32_t fallback)
+    {
+        uint64_t target = std::max(m_timers[index].deadline, m_now);
+        uint32_t bucket = bucketOf(target);
+        for (size_t attempt = 0; m_buckets[bucket].size() == BUCKET_CAPACITY; attempt++)
+        {
+            if (attempt == LEVELS * SLOTS)
+            {
+                bucket = fallback;
+                break;
+            }
+            target += uint64_t(1) << (SLOT_BITS * (bucket / SLOTS));
+            bucket = bucketOf(target);
+        }
+        insert(index, bucket);
+    }
+    /**
+     * @brief Redistributes a higher level bucket whose slot was reached into lower levels
+     * 
+     * @param source
+     */
+    void cascade(uint32_t source)
+    {
+        SVector<uint32_t, BUCKET_CAPACITY> moving = std::move(m_buckets[source]);
+        m_buckets[source].clear();
+        for (uint32_t index : moving)
+        {
+            place(index, source);
+        }
+    }
+
+    /**
+     * @brief Timer indices of every slot of every level, level major
+     * 
+     */
+    SVector<uint32_t, BUCKET_CAPACITY> m_buckets[LEVELS * SLOTS];
+    /**
+     * @brief Pool of timers, grows until MAX_TIMERS and then reuses released timers
+     * 
+     */
+    SVector<Timer, MAX_TIMERS> m_timers;
+    /**
+     * @brief Payloads fired by the last tick
+     * 
+     */
+    SVector<Payload, BUCKET_CAPACITY> m_fired;
+    /**
+     * @brief First released timer
+     * 
+     */
+    uint32_t m_free = NONE;
+    /**
+     * @brief Amount of pending timers
+     * 
+     */
+    size_t m_size = 0;
+    /**
+     * @brief Current tick
+     * 
+     */
+    uint64_t m_now;
+};
+
+}
+
+#endif // SVEC_STIMER_WHEEL END
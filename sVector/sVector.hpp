@@ -16,8 +16,19 @@
 #define SVEC_SVECTOR
 
 #include <iostream>
+#include <compare>
+#include <cstdint>
+#include <functional>
 #include <type_traits>
 #include <cstring>
+#include <algorithm>
+#include <memory>
+#include <iterator>
+#include <utility>
+
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#endif
 
 namespace svec 
 {
@@ -58,23 +69,73 @@ struct Printable : std::false_type {};
 template <typename T>
 struct Printable<T, std::void_t<decltype(std::cout << std::declval<T>())>> : std::true_type {};
 
+/**
+ * @brief SFINAE check for whether or not object is a lazy element-wise expression from sExpression.hpp (False).
+ * 
+ * @tparam T type.
+ */
+template <typename T, typename = void>
+struct IsExpression : std::false_type {};
+
+/**
+ * @brief SFINAE check for whether or not object is a lazy element-wise expression from sExpression.hpp (True).
+ * If this struct is chosen the expression can be assigned to a SVector, which evaluates it in a single pass.
+ * 
+ * @tparam T type.
+ */
+template <typename T>
+struct IsExpression<T, std::void_t<typename T::ExpressionTag>> : std::true_type {};
+
+/**
+ * @brief Checks if memcmp orders an array of T the same way as comparing element by element,
+ * which holds for single byte unsigned types.
+ * 
+ * @tparam T type.
+ */
+template <typename T>
+struct IsByteComparable : std::bool_constant<sizeof(T) == 1 && (std::is_same_v<T, std::byte> ||
+                                             (std::is_integral_v<T> && std::is_unsigned_v<T> && !std::is_same_v<T, bool>))> {};
+
+/**
+ * @brief Size of a cache line, used to keep padded SVectors from sharing lines.
+ * 
+ */
+inline constexpr size_t CACHE_LINE_SIZE = 64;
+
 /**
  * @brief Vector like container that is stored on the stack rather than the heap. 
  * 
  * @tparam T type stored in container
  * @tparam CAPACITY size allocated on stack
+ * @tparam ALIGNMENT alignment of the element array, raise it for aligned SIMD loads. 
+ * Since the whole SVector takes this alignment its size is also rounded up to a multiple of it.
  */
-template<typename T, size_t CAPACITY>
+template<typename T, size_t CAPACITY, size_t ALIGNMENT = alignof(T)>
 class SVector
 {
+    static_assert(ALIGNMENT >= alignof(T), "SVector alignment can not be less than alignof(T)");
+    static_assert((ALIGNMENT & (ALIGNMENT - 1)) == 0, "SVector alignment has to be a power of two");
 public:
     /**
-     * @brief Forward iterator for SVector container.
+     * @brief Random access iterator for SVector container.
      * 
      */
     class Iterator
     {
     public:
+        typedef T value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef T* pointer;
+        typedef T& reference;
+        typedef std::random_access_iterator_tag iterator_category;
+
+        /**
+         * @brief Construct a new Iterator object not pointing into any SVector
+         * 
+         */
+        Iterator() :
+            m_ptr(nullptr)
+        {}
         /**
          * @brief Construct a new Iterator object
          * 
@@ -131,17 +192,28 @@ public:
          * @param i amount forward
          * @return Iterator
          */
-        Iterator operator+(long i) const
+        Iterator operator+(difference_type i) const
         {
             return Iterator(m_ptr + i);
         }
+        /**
+         * @brief Increments copy of iterator forward by i
+         * 
+         * @param i amount forward
+         * @param iterator
+         * @return Iterator
+         */
+        friend Iterator operator+(difference_type i, const Iterator& iterator)
+        {
+            return iterator + i;
+        }
         /**
          * @brief Increments pointer forward by i
          * 
          * @param i amount forward
          * @return Iterator&
          */
-        Iterator& operator+=(long i)
+        Iterator& operator+=(difference_type i)
         {
             m_ptr += i;
             return *this;
@@ -152,7 +224,7 @@ public:
          * @param i amount backward
          * @return Iterator
          */
-        Iterator operator-(long i) const
+        Iterator operator-(difference_type i) const
         {
             return Iterator(m_ptr - i);
         }
@@ -162,7 +234,7 @@ public:
          * @param i amount backward
          * @return Iterator&
          */
-        Iterator& operator-=(long i)
+        Iterator& operator-=(difference_type i)
         {
             m_ptr -= i;
             return *this;
@@ -171,9 +243,9 @@ public:
          * @brief Finds difference between self and other iterator
          * 
          * @param ptr other iterator
-         * @return ssize_t
+         * @return difference_type
          */
-        ssize_t operator-(const Iterator& ptr) const
+        difference_type operator-(const Iterator& ptr) const
         {
             return m_ptr - ptr.m_ptr;
         }
@@ -183,7 +255,7 @@ public:
          * @param index amount forward from pointer
          * @return T&
          */
-        T& operator[](size_t index)
+        T& operator[](difference_type index) const
         {
             return *(m_ptr + index);
         }
@@ -192,7 +264,7 @@ public:
          * 
          * @return T*
          */
-        T* operator->()
+        T* operator->() const
         {
             return m_ptr;
         }
@@ -201,7 +273,7 @@ public:
          * 
          * @return T&
          */
-        T& operator*()
+        T& operator*() const
         {
             return *m_ptr;
         }
@@ -228,7 +300,7 @@ public:
             return m_ptr != other.m_ptr;
         }
         /**
-         * @brief Checks if iterator is less than this iterator
+         * @brief Checks if this iterator is past other
          * 
          * @param other 
          * @return true 
@@ -239,7 +311,7 @@ public:
             return m_ptr > other.m_ptr;
         }
         /**
-         * @brief Checks if iterator is less than or equal this iterator
+         * @brief Checks if this iterator is past or at other
          * 
          * @param other 
          * @return true 
@@ -250,7 +322,7 @@ public:
             return m_ptr >= other.m_ptr;
         }
         /**
-         * @brief Checks if iterator is greater than this iterator
+         * @brief Checks if this iterator is before other
          * 
          * @param other 
          * @return true 
@@ -258,10 +330,10 @@ public:
          */
         bool operator<(const Iterator& other) const
         {
-            return m_ptr > other.m_ptr;
+            return m_ptr < other.m_ptr;
         }
         /**
-         * @brief Checks if iterator is greater than or equal to this iterator
+         * @brief Checks if this iterator is before or at other
          * 
          * @param other 
          * @return true 
@@ -269,14 +341,8 @@ public:
          */
         bool operator<=(const Iterator& other) const
         {
-            return m_ptr >= other.m_ptr;
+            return m_ptr <= other.m_ptr;
         }
-    public:
-        typedef T value_type;
-        typedef T difference_type;
-        typedef T* pointer;
-        typedef T& reference;
-        typedef std::forward_iterator_tag iterator_category;
     private:
         /**
          * @brief Pointer to where iterator is.
@@ -285,20 +351,41 @@ public:
         T* m_ptr;
     };
     /**
-     * @brief Input iterator for SVector container.
+     * @brief Random access iterator over const elements of SVector container.
      * 
      */
     class ConstIterator
     {
     public:
+        typedef T value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const T* pointer;
+        typedef const T& reference;
+        typedef std::random_access_iterator_tag iterator_category;
+
         /**
-         * @brief Construct a new Iterator object
+         * @brief Construct a new ConstIterator object not pointing into any SVector
+         * 
+         */
+        ConstIterator() :
+            m_ptr(nullptr)
+        {}
+        /**
+         * @brief Construct a new ConstIterator object
          * 
          * @param ptr pointer located in SVector container
          */
         ConstIterator(const T* ptr) :
             m_ptr(ptr)
         {}
+        /**
+         * @brief Construct a new ConstIterator object at the same element as iterator
+         * 
+         * @param iterator
+         */
+        ConstIterator(const Iterator& iterator) :
+            m_ptr(iterator.operator->())
+        {}
         /**
          * @brief Iterates pointer forward by one
          * 
@@ -347,17 +434,28 @@ public:
          * @param i amount forward
          * @return ConstIterator
          */
-        ConstIterator operator+(long i) const
+        ConstIterator operator+(difference_type i) const
         {
             return ConstIterator(m_ptr + i);
         }
+        /**
+         * @brief Increments copy of iterator forward by i
+         * 
+         * @param i amount forward
+         * @param iterator
+         * @return ConstIterator
+         */
+        friend ConstIterator operator+(difference_type i, const ConstIterator& iterator)
+        {
+            return iterator + i;
+        }
         /**
          * @brief Increments pointer forward by i
          * 
          * @param i amount forward
          * @return ConstIterator&
          */
-        ConstIterator& operator+=(long i)
+        ConstIterator& operator+=(difference_type i)
         {
             m_ptr += i;
             return *this;
@@ -368,7 +466,7 @@ public:
          * @param i amount backward
          * @return ConstIterator
          */
-        ConstIterator operator-(long i) const
+        ConstIterator operator-(difference_type i) const
         {
             return ConstIterator(m_ptr - i);
         }
@@ -378,7 +476,7 @@ public:
          * @param i amount backward
          * @return ConstIterator&
          */
-        ConstIterator& operator-=(long i)
+        ConstIterator& operator-=(difference_type i)
         {
             m_ptr -= i;
             return *this;
@@ -387,19 +485,19 @@ public:
          * @brief Finds difference between self and other iterator
          * 
          * @param ptr other iterator
-         * @return ssize_t
+         * @return difference_type
          */
-        ssize_t operator-(const ConstIterator& ptr) const
+        difference_type operator-(const ConstIterator& ptr) const
         {
             return m_ptr - ptr.m_ptr;
         }
         /**
-         * @brief Gets T& value an amount forward from iterator
+         * @brief Gets const T& value an amount forward from iterator
          * 
          * @param index amount forward from pointer
          * @return const T&
          */
-        const T& operator[](size_t index)
+        const T& operator[](difference_type index) const
         {
             return *(m_ptr + index);
         }
@@ -408,7 +506,7 @@ public:
          * 
          * @return const T*
          */
-        const T* operator->()
+        const T* operator->() const
         {
             return m_ptr;
         }
@@ -417,7 +515,7 @@ public:
          * 
          * @return const T&
          */
-        const T& operator*()
+        const T& operator*() const
         {
             return *m_ptr;
         }
@@ -444,7 +542,7 @@ public:
             return m_ptr != other.m_ptr;
         }
         /**
-         * @brief Checks if iterator is less than this iterator
+         * @brief Checks if this iterator is past other
          * 
          * @param other 
          * @return true 
@@ -455,7 +553,7 @@ public:
             return m_ptr > other.m_ptr;
         }
         /**
-         * @brief Checks if iterator is less than or equal this iterator
+         * @brief Checks if this iterator is past or at other
          * 
          * @param other 
          * @return true 
@@ -466,7 +564,7 @@ public:
             return m_ptr >= other.m_ptr;
         }
         /**
-         * @brief Checks if iterator is greater than this iterator
+         * @brief Checks if this iterator is before other
          * 
          * @param other 
          * @return true 
@@ -474,10 +572,10 @@ public:
          */
         bool operator<(const ConstIterator& other) const
         {
-            return m_ptr > other.m_ptr;
+            return m_ptr < other.m_ptr;
         }
         /**
-         * @brief Checks if iterator is greater than or equal to this iterator
+         * @brief Checks if this iterator is before or at other
          * 
          * @param other 
          * @return true 
@@ -485,14 +583,8 @@ public:
          */
         bool operator<=(const ConstIterator& other) const
         {
-            return m_ptr >= other.m_ptr;
+            return m_ptr <= other.m_ptr;
         }
-    public:
-        typedef const T value_type;
-        typedef const T difference_type;
-        typedef const T* pointer;
-        typedef const T& reference;
-        typedef std::input_iterator_tag iterator_category;
     private:
         /**
          * @brief Pointer to where iterator is.
@@ -518,58 +610,139 @@ public:
     SVector(std::initializer_list<T>&& initList) :
         m_size{initList.size()}
     {
-        std::copy(initList.begin(), initList.end(), m_array);
+        std::uninitialized_copy(initList.begin(), initList.end(), m_array);
     }
+    /**
+     * @brief Copies whole SVector Object bytewise when T is trivially copyable, which keeps SVector trivially copyable
+     * so containers can relocate it with memcpy. The full capacity is copied, not just size elements.
+     * 
+     */
+    SVector(const SVector&) requires std::is_trivially_copyable_v<T> = default;
     /**
      * @brief Deep Copies SVector Object
      * 
      * @param other 
      */
-    SVector(const SVector<T, CAPACITY>& other) :
+    SVector(const SVector& other) noexcept(std::is_nothrow_copy_constructible_v<T>)
+        requires (std::is_copy_constructible_v<T> && !std::is_trivially_copyable_v<T>) :
         m_size{other.m_size}
     {
-        std::copy(std::begin(other.m_array), std::end(other.m_array), std::begin(m_array));
+        std::uninitialized_copy(other.m_array, other.m_array + other.m_size, m_array);
     }
     /**
-     * @brief Moves SVector Object
+     * @brief Copies whole SVector Object bytewise when T is trivially copyable
+     * 
+     */
+    SVector(SVector&&) requires std::is_trivially_copyable_v<T> = default;
+    /**
+     * @brief Moves SVector Object, elements of other are left in a moved from state.
+     * noexcept when T's move constructor is, so std::vector moves SVectors instead of copying them when it grows.
      * 
      * @param other 
      */
-    SVector(SVector<T, CAPACITY>&& other) :
-        m_array(std::move(other.m_array)),
-        m_size{std::move(other.m_size)}
+    SVector(SVector&& other) noexcept(std::is_nothrow_move_constructible_v<T>) :
+        m_size{other.m_size}
+    {
+        std::uninitialized_move(other.m_array, other.m_array + other.m_size, m_array);
+    }
+    /**
+     * @brief Construct a new SVector object by evaluating an element-wise expression
+     * 
+     * @tparam EXPR expression from sExpression.hpp
+     * @param expression
+     */
+    template<typename EXPR, typename = std::enable_if_t<IsExpression<EXPR>::value>>
+    SVector(const EXPR& expression) :
+        m_size{0}
     {
-        
+        *this = expression;
+    }
+    /**
+     * @brief Nothing to destroy when T is trivially destructible
+     * 
+     */
+    ~SVector() requires std::is_trivially_destructible_v<T> = default;
+    /**
+     * @brief Destroys elements currently in SVector
+     * 
+     */
+    ~SVector()
+    {
+        std::destroy(m_array, m_array + m_size);
     }
     /**
      * @brief Sets SVector Object equal to array
      * 
      * @param initList 
+     * @return SVector& 
      */
-    void operator=(const std::initializer_list<T>& initList)
+    SVector& operator=(const std::initializer_list<T>& initList)
     {
-        std::copy(initList.begin(), initList.end(), std::begin(m_array));
-        m_size = initList.size();
+        assign(initList.begin(), initList.size());
+        return *this;
     }
     /**
-     * @brief Moves SVector Object
+     * @brief Copies whole SVector Object bytewise when T is trivially copyable
+     * 
+     * @return SVector& 
+     */
+    SVector& operator=(SVector&&) requires std::is_trivially_copyable_v<T> = default;
+    /**
+     * @brief Moves SVector Object, elements of other are left in a moved from state
      * 
      * @param other 
+     * @return SVector& 
      */
-    void operator=(SVector<T, CAPACITY>&& other)
+    SVector& operator=(SVector&& other) noexcept(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_assignable_v<T>)
     {
-        m_array = std::move(other.m_array);
-        m_size = std::move(other.m_size);
+        if (this != &other)
+        {
+            assign(std::make_move_iterator(other.m_array), other.m_size);
+        }
+        return *this;
     }
+    /**
+     * @brief Copies whole SVector Object bytewise when T is trivially copyable
+     * 
+     * @return SVector& 
+     */
+    SVector& operator=(const SVector&) requires std::is_trivially_copyable_v<T> = default;
     /**
      * @brief Deep Copies SVector Object
      * 
      * @param other 
+     * @return SVector& 
      */
-    void operator=(const SVector<T, CAPACITY>& other)
+    SVector& operator=(const SVector& other) noexcept(std::is_nothrow_copy_constructible_v<T> && std::is_nothrow_copy_assignable_v<T>)
+        requires (std::is_copy_constructible_v<T> && !std::is_trivially_copyable_v<T>)
     {
-        std::copy(std::begin(other.m_array), std::end(other.m_array), std::begin(m_array));
-        m_size = other.m_size;
+        if (this != &other)
+        {
+            assign(static_cast<const T*>(other.m_array), other.m_size);
+        }
+        return *this;
+    }
+    /**
+     * @brief Evaluates an element-wise expression into this SVector in one fused pass.
+     * Size becomes the smallest size of the SVectors in the expression, which may include this one.
+     * 
+     * @tparam EXPR expression from sExpression.hpp
+     * @param expression
+     * @return SVector& 
+     */
+    template<typename EXPR>
+    std::enable_if_t<IsExpression<EXPR>::value, SVector&>
+    operator=(const EXPR& expression)
+    {
+        // the count is read before resizing so the loop bound is a local the compiler can vectorize against
+        size_t count = expression.size();
+        resizeForOverwrite(count);
+        T* out = data();
+        for (size_t i = 0; i < count; i++)
+        {
+            out[i] = static_cast<T>(expression[i]);
+        }
+        return *this;
     }
 
     /**
@@ -577,13 +750,14 @@ public:
      * 
      * @tparam U T
      * @tparam C capacity of other SVector 
+     * @tparam A alignment of other SVector 
      * @param other
      * @return bool 
      */
-    template<typename U = T, size_t C>
+    template<typename U = T, size_t C, size_t A>
     std::enable_if<HasEquals<U>::value, 
             bool>::type
-    operator==(const SVector<U, C>& other) const
+    operator==(const SVector<U, C, A>& other) const
     {
         if (other.size() != m_size) 
         {
@@ -603,13 +777,14 @@ public:
      * 
      * @tparam U T
      * @tparam C capacity of other SVector 
+     * @tparam A alignment of other SVector 
      * @param other 
      * @return bool
      */
-    template<typename U = T, size_t C>
+    template<typename U = T, size_t C, size_t A>
     std::enable_if<HasEquals<U>::value, 
             bool>::type
-    operator==(const SVector<U, C>& other)
+    operator==(const SVector<U, C, A>& other)
     {
         if (other.size() != m_size) 
         {
@@ -629,13 +804,14 @@ public:
      * 
      * @tparam U 
      * @tparam C 
+     * @tparam A 
      * @param other 
      * @return bool
      */
-    template<typename U = T, size_t C>
+    template<typename U = T, size_t C, size_t A>
     std::enable_if<!HasEquals<U>::value, 
             bool>::type
-    operator==(const SVector<U, C>& other) const
+    operator==(const SVector<U, C, A>& other) const
     {
         if (other.size() != m_size) 
         {
@@ -725,6 +901,30 @@ public:
         }
         return true;
     }
+    /**
+     * @brief Compares two SVectors lexicographically, a shorter SVector that is a prefix of the other orders first.
+     * Single byte unsigned elements compare with one memcmp of the shared prefix.
+     * 
+     * @tparam U T
+     * @tparam C capacity of other SVector 
+     * @tparam A alignment of other SVector 
+     * @param other 
+     * @return std::compare_three_way_result_t<U> 
+     */
+    template<typename U = T, size_t C, size_t A>
+        requires (std::is_same_v<U, T> && std::three_way_comparable<U>)
+    std::compare_three_way_result_t<U> operator<=>(const SVector<U, C, A>& other) const
+    {
+        if constexpr (IsByteComparable<U>::value)
+        {
+            int result = memcmp(m_array, other.data(), std::min(m_size, other.size()));
+            return result != 0 ? result <=> 0 : m_size <=> other.size();
+        }
+        else
+        {
+            return std::lexicographical_compare_three_way(m_array, m_array + m_size, other.data(), other.data() + other.size());
+        }
+    }
 
     /**
      * @brief Returns iterator at start of array
@@ -813,6 +1013,24 @@ public:
     {
         return CAPACITY;
     }
+    /**
+     * @brief Returns pointer to the first element of the underlying array, compiler is told it is aligned to ALIGNMENT
+     * 
+     * @return T* 
+     */
+    inline T* data()
+    {
+        return std::assume_aligned<ALIGNMENT>(static_cast<T*>(m_array));
+    }
+    /**
+     * @brief Returns pointer to the first element of the underlying array, compiler is told it is aligned to ALIGNMENT
+     * 
+     * @return const T* 
+     */
+    inline const T* data() const
+    {
+        return std::assume_aligned<ALIGNMENT>(static_cast<const T*>(m_array));
+    }
     /**
      * @brief Returns last element
      * 
@@ -857,8 +1075,7 @@ public:
      */
     inline void pushBack(const T& element)
     {
-        m_array[m_size] = element;
-        m_size++;
+        emplaceBack(element);
     }
     /**
      * @brief Adds element to back of SVector and increases size
@@ -867,8 +1084,47 @@ public:
      */
     inline void pushBack(T&& element)
     {
-        m_array[m_size] = element;
-        m_size++;
+        emplaceBack(std::move(element));
+    }
+    /**
+     * @brief Adds element to back if there is room, never throws on a full SVector
+     * 
+     * @param element
+     * @return T* added element, nullptr if SVector was full
+     */
+    inline T* tryPushBack(const T& element)
+    {
+        return tryEmplaceBack(element);
+    }
+    /**
+     * @brief Adds element to back if there is room, never throws on a full SVector. Element is not moved from when full.
+     * 
+     * @param element
+     * @return T* added element, nullptr if SVector was full
+     */
+    inline T* tryPushBack(T&& element)
+    {
+        return tryEmplaceBack(std::move(element));
+    }
+    /**
+     * @brief Adds element to back without any check, size has to be less than capacity.
+     * Compiles down to a construction and an increment.
+     * 
+     * @param element
+     */
+    inline void uncheckedPushBack(const T& element)
+    {
+        uncheckedEmplaceBack(element);
+    }
+    /**
+     * @brief Adds element to back without any check, size has to be less than capacity.
+     * Compiles down to a construction and an increment.
+     * 
+     * @param element
+     */
+    inline void uncheckedPushBack(T&& element)
+    {
+        uncheckedEmplaceBack(std::move(element));
     }
     /**
      * @brief Adds element to front of SVector and increases size
@@ -877,12 +1133,7 @@ public:
      */
     inline void pushFront(const T& element)
     {
-        for (size_t i = m_size-1; i != SIZE_MAX; i--) 
-        {
-            m_array[i + 1] = m_array[i];
-        }
-        m_array[0] = element;
-        m_size++;
+        insert(0, element);
     }
     /**
      * @brief Adds element to front of SVector and increases size
@@ -891,12 +1142,7 @@ public:
      */
     inline void pushFront(T&& element)
     {
-        for (size_t i = m_size-1; i != SIZE_MAX; i--) 
-        {
-            m_array[i + 1] = m_array[i];
-        }
-        m_array[0] = element;
-        m_size++;
+        insert(0, std::move(element));
     }
     /**
      * @brief Removes element from back
@@ -905,6 +1151,7 @@ public:
     inline void popBack()
     {
         m_size--;
+        std::destroy_at(m_array + m_size);
     }
     /**
      * @brief Removes element from front
@@ -912,11 +1159,7 @@ public:
      */
     inline void popFront()
     {
-        m_size--;
-        for (size_t i = 0; i < m_size; i++) 
-        {
-            m_array[i] = m_array[i + 1];
-        }
+        erase(0);
     }
     /**
      * @brief Inserts element into array
@@ -926,12 +1169,7 @@ public:
      */
     inline void insert(size_t index, const T& element)
     {
-        for (size_t i = m_size-1; i >= index && i != index-1u; i--) 
-        {
-            m_array[i + 1] = m_array[i];
-        }
-        m_array[index] = element;
-        m_size++;
+        emplace(index, element);
     }
     /**
      * @brief Inserts element into array
@@ -941,12 +1179,13 @@ public:
      */
     inline void insert(size_t index, T&& element)
     {
-        for (size_t i = m_size-1; i >= index && i != index-1u; i--) 
+        if (index == m_size)
         {
-            m_array[i + 1] = m_array[i];
+            pushBack(std::move(element));
+            return;
         }
-        m_array[index] = element;
-        m_size++;
+        openGap(index);
+        m_array[index] = std::move(element);
     }
     /**
      * @brief Removes element from array
@@ -955,64 +1194,228 @@ public:
      */
     inline void erase(size_t index)
     {
-        m_size--;
-        for (size_t i = index; i < m_size; i++) 
+        std::move(m_array + index + 1, m_array + m_size, m_array + index);
+        popBack();
+    }
+    /**
+     * @brief Changes size to count. New elements are left uninitialized when T is trivially default constructible,
+     * otherwise they are default constructed. Meant for filling the SVector directly through data().
+     * 
+     * @param count new size
+     */
+    inline void resizeForOverwrite(size_t count)
+    {
+    #ifdef _DEBUG
+        if (count > CAPACITY)
+        {
+            throw std::out_of_range("ERROR: size " + std::to_string(count) + " is larger than capacity " + std::to_string(CAPACITY));
+        }
+    #endif // _DEBUG end
+        if (count < m_size)
+        {
+            std::destroy(m_array + count, m_array + m_size);
+        }
+        else if constexpr (!std::is_trivially_default_constructible_v<T>)
+        {
+            std::uninitialized_default_construct(m_array + m_size, m_array + count);
+        }
+        m_size = count;
+    }
+    /**
+     * @brief Changes size to count. New elements are value initialized, removed elements are destroyed.
+     * 
+     * @param count new size
+     */
+    inline void resize(size_t count)
+    {
+    #ifdef _DEBUG
+        if (count > CAPACITY)
+        {
+            throw std::out_of_range("ERROR: size " + std::to_string(count) + " is larger than capacity " + std::to_string(CAPACITY));
+        }
+    #endif // _DEBUG end
+        if (count < m_size)
+        {
+            std::destroy(m_array + count, m_array + m_size);
+        }
+        else
+        {
+            std::uninitialized_value_construct(m_array + m_size, m_array + count);
+        }
+        m_size = count;
+    }
+    /**
+     * @brief Changes size to count. New elements are copies of value, removed elements are destroyed.
+     * 
+     * @param count new size
+     * @param value
+     */
+    inline void resize(size_t count, const T& value)
+    {
+    #ifdef _DEBUG
+        if (count > CAPACITY)
+        {
+            throw std::out_of_range("ERROR: size " + std::to_string(count) + " is larger than capacity " + std::to_string(CAPACITY));
+        }
+    #endif // _DEBUG end
+        if (count < m_size)
+        {
+            std::destroy(m_array + count, m_array + m_size);
+        }
+        else
+        {
+            std::uninitialized_fill(m_array + m_size, m_array + count, value);
+        }
+        m_size = count;
+    }
+    /**
+     * @brief Storage never grows so this only checks count against capacity, at compile time when count is constant
+     * 
+     * @param count
+     */
+    static constexpr void reserve(size_t count)
+    {
+        if (count > CAPACITY)
         {
-            m_array[i] = m_array[i + 1];
+            throw std::length_error("ERROR: can not reserve " + std::to_string(count) + ", capacity is " + std::to_string(CAPACITY));
         }
     }
     /**
-     * @brief Emplaces element at the back of the SVector
+     * @brief Removes every element
+     * 
+     */
+    inline void clear()
+    {
+        std::destroy(m_array, m_array + m_size);
+        m_size = 0;
+    }
+    /**
+     * @brief Emplaces element at the back of the SVector, element is constructed in place
      * 
      * @tparam ARGS 
      * @param args 
+     * @return T& emplaced element
      */
     template<typename... ARGS>
-    inline void emplaceBack(ARGS&&... args)
+    inline T& emplaceBack(ARGS&&... args)
     {
-        m_array[m_size] = T(std::forward<ARGS>(args)...);
-        m_size++;
+    #ifdef _DEBUG
+        if (m_size >= CAPACITY)
+        {
+            throw std::out_of_range("ERROR: can not add element, SVector is at capacity " + std::to_string(CAPACITY));
+        }
+    #endif // _DEBUG end
+        return uncheckedEmplaceBack(std::forward<ARGS>(args)...);
     }
     /**
-     * @brief Emplaces element at the front of the SVector
+     * @brief Emplaces element at the back if there is room, never throws on a full SVector
      * 
      * @tparam ARGS 
      * @param args 
+     * @return T* emplaced element, nullptr if SVector was full
      */
     template<typename... ARGS>
-    inline void emplaceFront(ARGS&&... args)
+    inline T* tryEmplaceBack(ARGS&&... args)
     {
-        for (size_t i = m_size-1; i != SIZE_MAX; i--) 
+        if (m_size >= CAPACITY)
         {
-            m_array[i + 1] = m_array[i];
+            return nullptr;
         }
-        m_array[0] = T(std::forward<ARGS>(args)...);
+        return &uncheckedEmplaceBack(std::forward<ARGS>(args)...);
+    }
+    /**
+     * @brief Emplaces element at the back without any check, size has to be less than capacity
+     * 
+     * @tparam ARGS 
+     * @param args 
+     * @return T& emplaced element
+     */
+    template<typename... ARGS>
+    inline T& uncheckedEmplaceBack(ARGS&&... args)
+    {
+        T* element = std::construct_at(m_array + m_size, std::forward<ARGS>(args)...);
         m_size++;
+        return *element;
     }
     /**
-     * @brief Emplaces element at a specific element of array
+     * @brief Emplaces element at the front of the SVector
+     * 
+     * @tparam ARGS 
+     * @param args 
+     * @return T& emplaced element
+     */
+    template<typename... ARGS>
+    inline T& emplaceFront(ARGS&&... args)
+    {
+        return emplace(0, std::forward<ARGS>(args)...);
+    }
+    /**
+     * @brief Emplaces element at a specific element of array. 
+     * Element is constructed in place when index is the back, otherwise it is constructed before 
+     * shifting (so args may refer to elements of this SVector) and then moved into its slot.
      * 
      * @tparam ARGS 
      * @param index 
      * @param args 
+     * @return T& emplaced element
      */
     template<typename... ARGS>
-    inline void emplace(size_t index, ARGS&&... args)
+    inline T& emplace(size_t index, ARGS&&... args)
     {
-        for (size_t i = m_size-1; i >= index && i != index-1u; i--) 
+        if (index == m_size)
         {
-            m_array[i + 1] = m_array[i];
+            return emplaceBack(std::forward<ARGS>(args)...);
         }
-        m_array[index] = T(std::forward<ARGS>(args)...);
-        m_size++;
+        T element(std::forward<ARGS>(args)...);
+        openGap(index);
+        m_array[index] = std::move(element);
+        return m_array[index];
     }
 
 private:
     /**
-     * @brief Container on stack
+     * @brief Replaces contents with count elements read from first
      * 
+     * @tparam ITER pointer or move iterator
+     * @param first 
+     * @param count 
      */
-    T m_array[CAPACITY];
+    template<typename ITER>
+    inline void assign(ITER first, size_t count)
+    {
+        if (count <= m_size)
+        {
+            std::copy_n(first, count, m_array);
+            std::destroy(m_array + count, m_array + m_size);
+        }
+        else
+        {
+            std::copy_n(first, m_size, m_array);
+            std::uninitialized_copy_n(first + m_size, count - m_size, m_array + m_size);
+        }
+        m_size = count;
+    }
+    /**
+     * @brief Shifts elements [index, size) back by one using moves and increases size.
+     * Element at index is left in a moved from state. Index must be less than size.
+     * 
+     * @param index 
+     */
+    inline void openGap(size_t index)
+    {
+        std::construct_at(m_array + m_size, std::move(m_array[m_size - 1]));
+        std::move_backward(m_array + index, m_array + m_size - 1, m_array + m_size);
+        m_size++;
+    }
+
+    /**
+     * @brief Container on stack, kept in a union so elements are only constructed once they are added
+     * 
+     */
+    union
+    {
+        alignas(ALIGNMENT) T m_array[CAPACITY];
+    };
     /**
      * @brief Size of container being used
      * 
@@ -1020,19 +1423,200 @@ private:
     size_t m_size;
 };
 
+/**
+ * @brief SVector whose element array starts on a cache line and whose size is a multiple of the cache line,
+ * so neighbouring SVectors (for example per thread slots in an array) never share a line.
+ * 
+ * @tparam T type stored in container
+ * @tparam CAPACITY size allocated on stack
+ */
+template<typename T, size_t CAPACITY>
+using SPaddedVector = SVector<T, CAPACITY, std::max(CACHE_LINE_SIZE, alignof(T))>;
+
+/**
+ * @brief Hash kernels behind std::hash<SVector>
+ * 
+ */
+namespace hashing
+{
+
+/**
+ * @brief Full 64x64 to 128 bit multiply, uses the native 128 bit type or intrinsic where there is one
+ * 
+ * @param a
+ * @param b
+ * @param high upper 64 bits of product
+ * @return uint64_t lower 64 bits of product
+ */
+inline uint64_t multiply128(uint64_t a, uint64_t b, uint64_t& high)
+{
+#if defined(__SIZEOF_INT128__)
+    __uint128_t product = static_cast<__uint128_t>(a) * b;
+    high = static_cast<uint64_t>(product >> 64);
+    return static_cast<uint64_t>(product);
+#elif defined(_MSC_VER) && defined(_M_X64)
+    return _umul128(a, b, &high);
+#else
+    uint64_t aLow = a & 0xFFFFFFFF;
+    uint64_t aHigh = a >> 32;
+    uint64_t bLow = b & 0xFFFFFFFF;
+    uint64_t bHigh = b >> 32;
+    uint64_t lowLow = aLow * bLow;
+    uint64_t highLow = aHigh * bLow;
+    uint64_t lowHigh = aLow * bHigh;
+    uint64_t highHigh = aHigh * bHigh;
+    uint64_t cross = (lowLow >> 32) + (highLow & 0xFFFFFFFF) + lowHigh;
+    high = highHigh + (highLow >> 32) + (cross >> 32);
+    return (cross << 32) | (lowLow & 0xFFFFFFFF);
+#endif
+}
+/**
+ * @brief Multiplies into 128 bits and folds the halves together
+ * 
+ * @param a
+ * @param b
+ * @return uint64_t
+ */
+inline uint64_t mix(uint64_t a, uint64_t b)
+{
+    uint64_t high;
+    uint64_t low = multiply128(a, b, high);
+    return low ^ high;
+}
+/**
+ * @brief Reads 64 unaligned bits
+ * 
+ * @param p
+ * @return uint64_t
+ */
+inline uint64_t read64(const unsigned char* p)
+{
+    uint64_t value;
+    memcpy(&value, p, sizeof(value));
+    return value;
+}
+/**
+ * @brief Reads 32 unaligned bits
+ * 
+ * @param p
+ * @return uint64_t
+ */
+inline uint64_t read32(const unsigned char* p)
+{
+    uint32_t value;
+    memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+/**
+ * @brief Hashes a byte range in one pass, following wyhash: 48 bytes per round in three independent multiply lanes,
+ * then 16 byte steps, and ranges up to 16 bytes are read with at most four overlapping loads and no loop.
+ * 
+ * @param data
+ * @param size
+ * @param seed
+ * @return uint64_t
+ */
+inline uint64_t hashBytes(const void* data, size_t size, uint64_t seed = 0)
+{
+    constexpr uint64_t SECRET[4] = {0xa0761d6478bd642full, 0xe7037ed1a0b428dbull, 0x8ebc6af09c88c6e3ull, 0x589965cc75374cc3ull};
+    const unsigned char* p = static_cast<const unsigned char*>(data);
+    seed ^= mix(seed ^ SECRET[0], SECRET[1]);
+    uint64_t a;
+    uint64_t b;
+    if (size <= 16)
+    {
+        if (size >= 4)
+        {
+            size_t middle = (size >> 3) << 2;
+            a = (read32(p) << 32) | read32(p + middle);
+            b = (read32(p + size - 4) << 32) | read32(p + size - 4 - middle);
+        }
+        else if (size > 0)
+        {
+            a = (static_cast<uint64_t>(p[0]) << 16) | (static_cast<uint64_t>(p[size >> 1]) << 8) | p[size - 1];
+            b = 0;
+        }
+        else
+        {
+            a = 0;
+            b = 0;
+        }
+    }
+    else
+    {
+        size_t remaining = size;
+        if (remaining > 48)
+        {
+            uint64_t seed1 = seed;
+            uint64_t seed2 = seed;
+            do
+            {
+                seed = mix(read64(p) ^ SECRET[1], read64(p + 8) ^ seed);
+                seed1 = mix(read64(p + 16) ^ SECRET[2], read64(p + 24) ^ seed1);
+                seed2 = mix(read64(p + 32) ^ SECRET[3], read64(p + 40) ^ seed2);
+                p += 48;
+                remaining -= 48;
+            } while (remaining > 48);
+            seed ^= seed1 ^ seed2;
+        }
+        while (remaining > 16)
+        {
+            seed = mix(read64(p) ^ SECRET[1], read64(p + 8) ^ seed);
+            p += 16;
+            remaining -= 16;
+        }
+        a = read64(p + remaining - 16);
+        b = read64(p + remaining - 8);
+    }
+    uint64_t high;
+    uint64_t low = multiply128(a ^ SECRET[1], b ^ seed, high);
+    return mix(low ^ SECRET[0] ^ size, high ^ SECRET[1]);
+}
+
+/**
+ * @brief Hashes elements. Types whose equal values have equal bytes (integers, pointers, enums, packed structs)
+ * hash their bytes in one pass, anything else combines std::hash of every element.
+ * 
+ * @tparam T
+ * @param data
+ * @param size
+ * @return uint64_t
+ */
+template<typename T>
+inline uint64_t hashElements(const T* data, size_t size)
+{
+    if constexpr (std::has_unique_object_representations_v<T>)
+    {
+        return hashBytes(data, size * sizeof(T));
+    }
+    else
+    {
+        uint64_t hash = mix(size, 0xe7037ed1a0b428dbull);
+        for (size_t i = 0; i < size; i++)
+        {
+            hash = mix(hash ^ std::hash<T>{}(data[i]), 0xa0761d6478bd642full);
+        }
+        return hash;
+    }
+}
+
+}
+
 /**
  * @brief Prints SVector
  * 
  * @tparam T 
  * @tparam CAPACITY 
+ * @tparam ALIGNMENT 
  * @param out 
  * @param obj 
  * @return std::ostream&
  */
-template<typename T, size_t CAPACITY>
+template<typename T, size_t CAPACITY, size_t ALIGNMENT>
 std::enable_if<Printable<T>::value, 
         std::ostream&>::type
-operator<<(std::ostream &out, const SVector<T, CAPACITY>& obj)
+operator<<(std::ostream &out, const SVector<T, CAPACITY, ALIGNMENT>& obj)
 {
     out << "{";
     for (size_t i = 0; i < obj.size(); i++)
@@ -1049,4 +1633,21 @@ operator<<(std::ostream &out, const SVector<T, CAPACITY>& obj)
 
 }
 
+/**
+ * @brief Hashes the elements of a SVector, capacity and alignment do not take part so SVectors that compare equal
+ * hash equal
+ * 
+ * @tparam T 
+ * @tparam CAPACITY 
+ * @tparam ALIGNMENT 
+ */
+template<typename T, size_t CAPACITY, size_t ALIGNMENT>
+struct std::hash<svec::SVector<T, CAPACITY, ALIGNMENT>>
+{
+    size_t operator()(const svec::SVector<T, CAPACITY, ALIGNMENT>& vec) const noexcept
+    {
+        return svec::hashing::hashElements(vec.data(), vec.size());
+    }
+};
+
 #endif // SVEC_SVECTOR END
\ No newline at end of file
@@ -0,0 +1,146 @@
+// Copyright 2025 Dalton Prokosch
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SVEC_SVECTOR_IO
+#define SVEC_SVECTOR_IO
+
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include "sVector.hpp"
+
+namespace svec
+{
+
+/**
+ * @brief Checks if SVector<T> can be read into directly from a file descriptor.
+ * Element has to be a single trivial byte so partial reads never split an element and
+ * spare capacity can be written to before the size is grown with resizeForOverwrite.
+ * 
+ * @tparam T type.
+ */
+template <typename T>
+struct IsReadable : std::bool_constant<std::is_trivial_v<T> && sizeof(T) == 1> {};
+
+/**
+ * @brief Checks if SVector<T> can be written directly to a file descriptor.
+ * 
+ * @tparam T type.
+ */
+template <typename T>
+struct IsWritable : std::is_trivially_copyable<T> {};
+
+/**
+ * @brief Reads from fd directly into the spare capacity of vec and grows vec by the amount read.
+ * 
+ * @tparam T trivial byte sized type
+ * @tparam CAPACITY
+ * @tparam ALIGNMENT
+ * @param fd file descriptor
+ * @param vec
+ * @return ssize_t bytes read, 0 on end of file or when vec is full, -1 on error (errno is set by read)
+ */
+template<typename T, size_t CAPACITY, size_t ALIGNMENT>
+ssize_t readFrom(int fd, SVector<T, CAPACITY, ALIGNMENT>& vec)
+{
+    static_assert(IsReadable<T>::value, "readFrom requires a trivial byte sized type");
+    size_t size = vec.size();
+    if (size == CAPACITY)
+    {
+        return 0;
+    }
+    ssize_t amountRead = ::read(fd, vec.data() + size, CAPACITY - size);
+    vec.resizeForOverwrite(size + (amountRead > 0 ? amountRead : 0));
+    return amountRead;
+}
+
+/**
+ * @brief Writes the elements of vec starting at element offset to fd.
+ * Does not modify vec, callers drain it by erasing what was written.
+ * 
+ * @tparam T trivially copyable type
+ * @tparam CAPACITY
+ * @tparam ALIGNMENT
+ * @param fd file descriptor
+ * @param vec
+ * @param offset first element to write
+ * @return ssize_t bytes written, -1 on error (errno is set by write)
+ */
+template<typename T, size_t CAPACITY, size_t ALIGNMENT>
+ssize_t writeTo(int fd, const SVector<T, CAPACITY, ALIGNMENT>& vec, size_t offset = 0)
+{
+    static_assert(IsWritable<T>::value, "writeTo requires a trivially copyable type");
+#ifdef _DEBUG
+    if (offset > vec.size())
+    {
+        throw std::out_of_range("ERROR: offset " + std::to_string(offset) + " is larger than size " + std::to_string(vec.size()));
+    }
+#endif // _DEBUG end
+    return ::write(fd, vec.data() + offset, (vec.size() - offset) * sizeof(T));
+}
+
+/**
+ * @brief Reads from fd into the spare capacity of every vec with a single readv call.
+ * Vectors are filled in order and each one grows by the amount it received.
+ * 
+ * @tparam VECS SVectors of trivial byte sized types
+ * @param fd file descriptor
+ * @param vecs
+ * @return ssize_t bytes read, -1 on error (errno is set by readv)
+ */
+template<typename... VECS>
+ssize_t readv(int fd, VECS&... vecs)
+{
+    static_assert(sizeof...(VECS) > 0, "readv requires at least one SVector");
+    static_assert((IsReadable<std::remove_pointer_t<decltype(vecs.data())>>::value && ...),
+        "readv requires trivial byte sized types");
+
+    iovec batch[] = {iovec{vecs.data() + vecs.size(), vecs.capacity() - vecs.size()}...};
+    ssize_t amountRead = ::readv(fd, batch, sizeof...(VECS));
+
+    size_t remaining = amountRead > 0 ? amountRead : 0;
+    auto grow = [&remaining](auto& vec, const iovec& io)
+    {
+        size_t amount = std::min(remaining, io.iov_len);
+        vec.resizeForOverwrite(vec.size() + amount);
+        remaining -= amount;
+    };
+    size_t i = 0;
+    (grow(vecs, batch[i++]), ...);
+    return amountRead;
+}
+
+/**
+ * @brief Writes the elements of every vec with a single writev call.
+ * 
+ * @tparam VECS SVectors of trivially copyable types
+ * @param fd file descriptor
+ * @param vecs
+ * @return ssize_t bytes written, -1 on error (errno is set by writev)
+ */
+template<typename... VECS>
+ssize_t writev(int fd, const VECS&... vecs)
+{
+    static_assert(sizeof...(VECS) > 0, "writev requires at least one SVector");
+    static_assert((IsWritable<std::remove_cv_t<std::remove_pointer_t<decltype(vecs.data())>>>::value && ...),
+        "writev requires trivially copyable types");
+
+    const iovec batch[] = {iovec{const_cast<void*>(static_cast<const void*>(vecs.data())),
+        vecs.size() * sizeof(*vecs.data())}...};
+    return ::writev(fd, batch, sizeof...(VECS));
+}
+
+}
+
+#endif // SVEC_SVECTOR_IO END
@@ -0,0 +1,558 @@
+// Copyright 2025 Dalton Prokosch
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SVEC_SWINDOW
+#define SVEC_SWINDOW
+
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <tuple>
+#include <type_traits>
+
+#include "sVector.hpp"
+
+namespace svec
+{
+
+/**
+ * @brief Sliding window over the last N pushed values kept in an inline ring. Every aggregate in OPS is updated as values
+ * enter and leave the window, so push and every query are O(1) amortized instead of rescanning the window.
+ * An aggregate is a class template OP<T, N> with push(value, sequence), evict(value, sequence) and clear(),
+ * where sequence counts every value ever pushed. Query one with get<OP>(), for example get<WindowMin>().value().
+ * 
+ * @tparam T type of values
+ * @tparam N window size
+ * @tparam OPS aggregates maintained over the window
+ */
+template<typename T, size_t N, template<typename, size_t> typename... OPS>
+class SWindow
+{
+    static_assert(N > 0, "SWindow requires a window of at least 1");
+public:
+    /**
+     * @brief Construct a new empty SWindow object
+     * 
+     */
+    SWindow() :
+        m_pushed{0}
+    {
+
+    }
+
+    /**
+     * @brief Adds value to the window, evicting the oldest value once the window is full
+     * 
+     * @param value
+     */
+    void push(const T& value)
+    {
+        if (m_ring.size() < N)
+        {
+            m_ring.uncheckedPushBack(value);
+        }
+        else
+        {
+            T& slot = m_ring[m_pushed % N];
+            uint64_t evicted = m_pushed - N;
+            std::apply([&](auto&... ops) { (ops.evict(slot, evicted), ...); }, m_ops);
+            slot = value;
+        }
+        std::apply([&](auto&... ops) { (ops.push(value, m_pushed), ...); }, m_ops);
+        m_pushed++;
+    }
+    /**
+     * @brief Returns aggregate OP
+     * 
+     * @tparam OP one of OPS
+     * @return const OP<T, N>&
+     */
+    template<template<typename, size_t> typename OP>
+    inline const OP<T, N>& get() const
+    {
+        return std::get<OP<T, N>>(m_ops);
+    }
+    /**
+     * @brief Accesses value in window
+     * 
+     * @param i 0 is the oldest value
+     * @return const T&
+     */
+    inline const T& operator[](size_t i) const
+    {
+        return m_ring[(m_pushed - m_ring.size() + i) % N];
+    }
+    /**
+     * @brief Returns oldest value in window
+     * 
+     * @return const T&
+     */
+    inline const T& oldest() const
+    {
+        return (*this)[0];
+    }
+    /**
+     * @brief Returns newest value in window
+     * 
+     * @return const T&
+     */
+    inline const T& newest() const
+    {
+        return m_ring[(m_pushed - 1) % N];
+    }
+    /**
+     * @brief Returns amount of values in window
+     * 
+     * @return size_t
+     */
+    inline size_t size() const
+    {
+        return m_ring.size();
+    }
+    /**
+     * @brief Returns window size
+     * 
+     * @return size_t
+     */
+    inline size_t capacity() const
+    {
+        return N;
+    }
+    /**
+     * @brief Checks if window holds N values
+     * 
+     * @return true
+     * @return false
+     */
+    inline bool full() const
+    {
+        return m_ring.size() == N;
+    }
+    /**
+     * @brief Returns amount of values ever pushed
+     * 
+     * @return uint64_t
+     */
+    inline uint64_t pushed() const
+    {
+        return m_pushed;
+    }
+    /**
+     * @brief Removes every value and resets aggregates
+     * 
+     */
+    void clear()
+    {
+        m_ring.clear();
+        m_pushed = 0;
+        std::apply([](auto&... ops) { (ops.clear(), ...); }, m_ops);
+    }
+
+private:
+    /**
+     * @brief Values in window, value with sequence s is stored at s % N
+     * 
+     */
+    SVector<T, N> m_ring;
+    /**
+     * @brief Amount of values ever pushed
+     * 
+     */
+    uint64_t m_pushed;
+    /**
+     * @brief Aggregates
+     * 
+     */
+    std::tuple<OPS<T, N>...> m_ops;
+};
+
+/**
+ * @brief Least or greatest value of the window through a monotonic deque. Values that can never be the extreme again
+ * are dropped as newer values arrive, so the front of the deque is always the answer.
+ * 
+ * @tparam T type of values
+ * @tparam N window size
+ * @tparam COMPARE value returned is the one no other value compares less than
+ */
+template<typename T, size_t N, typename COMPARE>
+class WindowExtreme
+{
+public:
+    /**
+     * @brief Drops values newer value beats and appends value
+     * 
+     * @param value
+     * @param sequence
+     */
+    inline void push(const T& value, uint64_t sequence)
+    {
+        while (m_size > 0 && !m_compare(m_entries[(m_head + m_size - 1) % N].value, value))
+        {
+            m_size--;
+        }
+        m_entries[(m_head + m_size) % N] = Entry{value, sequence};
+        m_size++;
+    }
+    /**
+     * @brief Drops front if it is the evicted value
+     * 
+     * @param sequence
+     */
+    inline void evict(const T&, uint64_t sequence)
+    {
+        if (m_size > 0 && m_entries[m_head].sequence == sequence)
+        {
+            m_head = (m_head + 1) % N;
+            m_size--;
+        }
+    }
+    /**
+     * @brief Returns extreme value, window can not be empty
+     * 
+     * @return const T&
+     */
+    inline const T& value() const
+    {
+        return m_entries[m_head].value;
+    }
+    /**
+     * @brief Empties deque
+     * 
+     */
+    inline void clear()
+    {
+        m_head = 0;
+        m_size = 0;
+    }
+
+private:
+    /**
+     * @brief Value and the sequence it was pushed with
+     * 
+     */
+    struct Entry
+    {
+        T value;
+        uint64_t sequence;
+    };
+
+    /**
+     * @brief Ring of candidates, values strictly ordered by COMPARE from front to back
+     * 
+     */
+    Entry m_entries[N];
+    /**
+     * @brief Index of the front candidate
+     * 
+     */
+    size_t m_head = 0;
+    /**
+     * @brief Amount of candidates
+     * 
+     */
+    size_t m_size = 0;
+    /**
+     * @brief Orders values
+     * 
+     */
+    COMPARE m_compare;
+};
+
+/**
+ * @brief Least value of the window
+ */
+template<typename T, size_t N>
+using WindowMin = WindowExtreme<T, N, std::less<T>>;
+/**
+ * @brief Greatest value of the window
+ */
+template<typename T, size_t N>
+using WindowMax = WindowExtreme<T, N, std::greater<T>>;
+
+/**
+ * @brief Running sum and mean of the window. Integers are summed in 64 bits, floating point values in double.
+ * 
+ * @tparam T type of values
+ * @tparam N window size
+ */
+template<typename T, size_t N>
+class WindowSum
+{
+public:
+    using SumType = std::conditional_t<std::is_floating_point_v<T>, double,
+                    std::conditional_t<std::is_signed_v<T>, int64_t, uint64_t>>;
+
+    /**
+     * @brief Adds value entering the window
+     * 
+     * @param value
+     */
+    inline void push(const T& value, uint64_t)
+    {
+        m_sum += static_cast<SumType>(value);
+        m_count++;
+    }
+    /**
+     * @brief Removes value leaving the window
+     * 
+     * @param value
+     */
+    inline void evict(const T& value, uint64_t)
+    {
+        m_sum -= static_cast<SumType>(value);
+        m_count--;
+    }
+    /**
+     * @brief Resets to an empty window
+     * 
+     */
+    inline void clear()
+    {
+        m_sum = 0;
+        m_count = 0;
+    }
+    /**
+     * @brief Returns sum of the window
+     * 
+     * @return SumType
+     */
+    inline SumType value() const
+    {
+        return m_sum;
+    }
+    /**
+     * @brief Returns mean of the window, window can not be empty
+     * 
+     * @return double
+     */
+    inline double mean() const
+    {
+        return static_cast<double>(m_sum) / static_cast<double>(m_count);
+    }
+
+private:
+    /**
+     * @brief Sum of values in window
+     * 
+     */
+    SumType m_sum = 0;
+    /**
+     * @brief Amount of values in window
+     * 
+     */
+    size_t m_count = 0;
+};
+
+/**
+ * @brief Running mean and variance of the window with Welford's update, which unlike a sum of squares
+ * does not lose precision when the variance is small next to the mean
+ * 
+ * @tparam T type of values
+ * @tparam N window size
+ */
+template<typename T, size_t N>
+class WindowVariance
+{
+public:
+    /**
+     * @brief Adds value entering the window
+     * 
+     * @param value
+     */
+    inline void push(const T& value, uint64_t)
+    {
+        double x = static_cast<double>(value);
+        m_count++;
+        double delta = x - m_mean;
+        m_mean += delta / static_cast<double>(m_count);
+        m_squares += delta * (x - m_mean);
+    }
+    /**
+     * @brief Removes value leaving the window
+     * 
+     * @param value
+     */
+    inline void evict(const T& value, uint64_t)
+    {
+        double x = static_cast<double>(value);
+        m_count--;
+        if (m_count == 0)
+        {
+            clear();
+            return;
+        }
+        double delta = x - m_mean;
+        m_mean -= delta / static_cast<double>(m_count);
+        m_squares = std::max(0.0, m_squares - delta * (x - m_mean));
+    }
+    /**
+     * @brief Resets to an empty window
+     * 
+     */
+    inline void clear()
+    {
+        m_count = 0;
+        m_mean = 0;
+        m_squares = 0;
+    }
+    /**
+     * @brief Returns mean of the window
+     * 
+     * @return double
+     */
+    inline double mean() const
+    {
+        return m_mean;
+    }
+    /**
+     * @brief Returns population variance of the window
+     * 
+     * @return double
+     */
+    inline double value() const
+    {
+        return m_count > 0 ? m_squares / static_cast<double>(m_count) : 0.0;
+    }
+    /**
+     * @brief Returns sample variance of the window
+     * 
+     * @return double
+     */
+    inline double sampleVariance() const
+    {
+        return m_count > 1 ? m_squares / static_cast<double>(m_count - 1) : 0.0;
+    }
+    /**
+     * @brief Returns population standard deviation of the window
+     * 
+     * @return double
+     */
+    inline double standardDeviation() const
+    {
+        return std::sqrt(value());
+    }
+
+private:
+    /**
+     * @brief Amount of values in window
+     * 
+     */
+    size_t m_count = 0;
+    /**
+     * @brief Mean of values in window
+     * 
+     */
+    double m_mean = 0;
+    /**
+     * @brief Sum of squared differences from the mean
+     * 
+     */
+    double m_squares = 0;
+};
+
+/**
+ * @brief Any associative combination of the window (gcd, bitwise or, matrix product...) with two stack amortization.
+ * New values go on a back stack with its running aggregate, evictions pop a front stack of suffix aggregates,
+ * which is refilled from the back stack once empty. Every value is combined a constant amount of times.
+ * Use through an alias, for example template<typename T, size_t N> using WindowGcd = WindowAggregate<T, N, Gcd>;
+ * 
+ * @tparam T type of values and aggregate
+ * @tparam N window size
+ * @tparam OP associative callable T(const T&, const T&), older operand first
+ */
+template<typename T, size_t N, typename OP>
+class WindowAggregate
+{
+public:
+    /**
+     * @brief Adds value entering the window
+     * 
+     * @param value
+     */
+    inline void push(const T& value, uint64_t)
+    {
+        m_backAggregate = m_back.size() == 0 ? value : m_op(m_backAggregate, value);
+        m_back.uncheckedPushBack(value);
+    }
+    /**
+     * @brief Removes value leaving the window
+     * 
+     * @param value
+     */
+    inline void evict(const T&, uint64_t)
+    {
+        if (m_front.size() == 0)
+        {
+            // Oldest value ends up on top of the front stack, each entry aggregates itself and every newer value
+            for (size_t i = m_back.size(); i-- > 0;)
+            {
+                m_front.uncheckedPushBack(m_front.size() == 0 ? m_back[i] : m_op(m_back[i], m_front.back()));
+            }
+            m_back.clear();
+        }
+        m_front.popBack();
+    }
+    /**
+     * @brief Resets to an empty window
+     * 
+     */
+    inline void clear()
+    {
+        m_front.clear();
+        m_back.clear();
+    }
+    /**
+     * @brief Returns aggregate of the window, window can not be empty
+     * 
+     * @return T
+     */
+    inline T value() const
+    {
+        if (m_front.size() == 0)
+        {
+            return m_backAggregate;
+        }
+        if (m_back.size() == 0)
+        {
+            return m_front.back();
+        }
+        return m_op(m_front.back(), m_backAggregate);
+    }
+
+private:
+    /**
+     * @brief Suffix aggregates of the oldest values, oldest on top
+     * 
+     */
+    SVector<T, N> m_front;
+    /**
+     * @brief Newest values, newest on top
+     * 
+     */
+    SVector<T, N> m_back;
+    /**
+     * @brief Aggregate of every value in m_back
+     * 
+     */
+    T m_backAggregate{};
+    /**
+     * @brief Combines two aggregates
+     * 
+     */
+    OP m_op;
+};
+
+}
+
+#endif // SVEC_SWINDOW END
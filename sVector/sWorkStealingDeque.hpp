@@ -0,0 +1,223 @@
+// Copyright 2025 Dalton Prokosch
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SVEC_SWORK_STEALING_DEQUE
+#define SVEC_SWORK_STEALING_DEQUE
+
+#include <atomic>
+#include <cstdint>
+#include <optional>
+#include <span>
+
+#include "sVector.hpp"
+
+namespace svec
+{
+
+/**
+ * @brief Bounded Chase-Lev work stealing deque stored inline. The owning thread pushes and pops at the bottom,
+ * any other thread steals from the top. Memory orderings follow the C11 version by Lê, Pop, Cohen and Zappa Nardelli.
+ * Slots are relaxed atomics so a thief reading a slot the owner is reusing is a failed steal rather than a data race,
+ * which is why T has to be trivially copyable; small handles such as pointers keep the slots lock free.
+ * 
+ * @tparam T trivially copyable type stored in deque
+ * @tparam CAPACITY max amount of elements, power of two
+ */
+template<typename T, size_t CAPACITY>
+class SWorkStealingDeque
+{
+    static_assert(std::is_trivially_copyable_v<T>, "SWorkStealingDeque requires a trivially copyable type");
+    static_assert(CAPACITY > 0 && (CAPACITY & (CAPACITY - 1)) == 0, "SWorkStealingDeque requires a power of two capacity");
+public:
+    /**
+     * @brief Construct a new empty SWorkStealingDeque object
+     * 
+     */
+    SWorkStealingDeque() = default;
+    SWorkStealingDeque(const SWorkStealingDeque&) = delete;
+    SWorkStealingDeque& operator=(const SWorkStealingDeque&) = delete;
+
+    /**
+     * @brief Adds element to the bottom. Owner thread only.
+     * 
+     * @param element
+     * @return true element was added
+     * @return false deque was full, run the work inline instead
+     */
+    inline bool push(const T& element)
+    {
+        int64_t bottom = m_bottom.load(std::memory_order_relaxed);
+        int64_t top = m_top.load(std::memory_order_acquire);
+        if (bottom - top >= static_cast<int64_t>(CAPACITY))
+        {
+            return false;
+        }
+        m_slots[bottom & MASK].store(element, std::memory_order_relaxed);
+        // Release store rather than the paper's release fence plus relaxed store, same cost and visible to sanitizers
+        m_bottom.store(bottom + 1, std::memory_order_release);
+        return true;
+    }
+    /**
+     * @brief Removes element from the bottom, most recently pushed first. Owner thread only.
+     * 
+     * @return std::optional<T> element, empty if deque was empty or a thief took the last element
+     */
+    inline std::optional<T> pop()
+    {
+        int64_t bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+        m_bottom.store(bottom, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t top = m_top.load(std::memory_order_relaxed);
+        if (top > bottom)
+        {
+            m_bottom.store(bottom + 1, std::memory_order_relaxed);
+            return std::nullopt;
+        }
+        T element = m_slots[bottom & MASK].load(std::memory_order_relaxed);
+        if (top == bottom)
+        {
+            // Last element, race thieves for it
+            bool won = m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+            m_bottom.store(bottom + 1, std::memory_order_relaxed);
+            if (!won)
+            {
+                return std::nullopt;
+            }
+        }
+        return element;
+    }
+    /**
+     * @brief Removes element from the top, least recently pushed first. Safe from any thread.
+     * 
+     * @return std::optional<T> element, empty if deque was empty or another thread won the race for it
+     */
+    inline std::optional<T> steal()
+    {
+        int64_t top = m_top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t bottom = m_bottom.load(std::memory_order_acquire);
+        if (top >= bottom)
+        {
+            return std::nullopt;
+        }
+        T element = m_slots[top & MASK].load(std::memory_order_relaxed);
+        if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+        {
+            return std::nullopt;
+        }
+        return element;
+    }
+    /**
+     * @brief Steals up to half of the elements, at most out.size(). Safe from any thread.
+     * Elements are claimed one compare exchange at a time since the owner pops without synchronizing
+     * unless one element is left, so claiming a range at once could overlap an owner pop.
+     * 
+     * @param out receives stolen elements, oldest first
+     * @return size_t amount of elements stolen
+     */
+    inline size_t stealBatch(std::span<T> out)
+    {
+        size_t count = std::min(out.size(), (size() + 1) / 2);
+        size_t stolen = 0;
+        while (stolen < count)
+        {
+            std::optional<T> element = steal();
+            if (!element)
+            {
+                break;
+            }
+            out[stolen++] = *element;
+        }
+        return stolen;
+    }
+    /**
+     * @brief Steals up to half of the elements of this deque and pushes them onto destination.
+     * Has to be called by the owner of destination.
+     * 
+     * @tparam C capacity of destination
+     * @param destination deque owned by the calling thread
+     * @return size_t amount of elements moved
+     */
+    template<size_t C>
+    inline size_t stealBatch(SWorkStealingDeque<T, C>& destination)
+    {
+        size_t count = std::min(C - std::min(destination.size(), C), (size() + 1) / 2);
+        size_t stolen = 0;
+        while (stolen < count)
+        {
+            std::optional<T> element = steal();
+            if (!element)
+            {
+                break;
+            }
+            destination.push(*element);
+            stolen++;
+        }
+        return stolen;
+    }
+
+    /**
+     * @brief Returns amount of elements, only a snapshot while other threads are running
+     * 
+     * @return size_t
+     */
+    inline size_t size() const
+    {
+        int64_t bottom = m_bottom.load(std::memory_order_relaxed);
+        int64_t top = m_top.load(std::memory_order_relaxed);
+        return bottom > top ? static_cast<size_t>(bottom - top) : 0;
+    }
+    /**
+     * @brief Checks if deque is empty, only a snapshot while other threads are running
+     * 
+     * @return true
+     * @return false
+     */
+    inline bool empty() const
+    {
+        return size() == 0;
+    }
+    /**
+     * @brief Returns max amount of elements
+     * 
+     * @return size_t
+     */
+    inline size_t capacity() const
+    {
+        return CAPACITY;
+    }
+
+private:
+    static constexpr int64_t MASK = static_cast<int64_t>(CAPACITY) - 1;
+
+    /**
+     * @brief Index of the oldest element, only ever incremented, by thieves or by the owner taking the last element
+     * 
+     */
+    alignas(CACHE_LINE_SIZE) std::atomic<int64_t> m_top{0};
+    /**
+     * @brief Index one past the newest element, only written by the owner
+     * 
+     */
+    alignas(CACHE_LINE_SIZE) std::atomic<int64_t> m_bottom{0};
+    /**
+     * @brief Ring of elements indexed by position modulo CAPACITY
+     * 
+     */
+    alignas(CACHE_LINE_SIZE) std::atomic<T> m_slots[CAPACITY];
+};
+
+}
+
+#endif // SVEC_SWORK_STEALING_DEQUE END
@@ -0,0 +1,257 @@
+// Copyright 2025 Dalton Prokosch
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gtest/gtest.h"
+#include "sBTree.hpp"
+
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+TEST(SBTree, InsertAndFind)
+{
+    svec::SBTree<int, std::string, 4> tree;
+    EXPECT_TRUE(tree.empty());
+    EXPECT_EQ(tree.find(1), nullptr);
+
+    EXPECT_TRUE(tree.insert(2, "two"));
+    EXPECT_TRUE(tree.insert(1, "one"));
+    EXPECT_FALSE(tree.insert(1, "uno")) << "insert should not replace an existing value";
+    EXPECT_EQ(*tree.find(1), "one");
+    EXPECT_FALSE(tree.insertOrAssign(1, "uno"));
+    EXPECT_EQ(*tree.find(1), "uno");
+    EXPECT_EQ(tree.size(), 2);
+    EXPECT_TRUE(tree.contains(2));
+    EXPECT_FALSE(tree.contains(3));
+}
+
+TEST(SBTree, MatchesMapUnderRandomOperations)
+{
+    svec::SBTree<int, int, 8> tree;
+    std::map<int, int> expected;
+    std::mt19937 random(7);
+    std::uniform_int_distribution<int> keys(-5'000, 5'000);
+    for (int i = 0; i < 50'000; i++)
+    {
+        int key = keys(random);
+        switch (random() % 4)
+        {
+        case 0:
+        case 1:
+            EXPECT_EQ(tree.insert(key, i), expected.emplace(key, i).second);
+            break;
+        case 2:
+            EXPECT_EQ(tree.insertOrAssign(key, i), !expected.contains(key));
+            expected[key] = i;
+            break;
+        default:
+            EXPECT_EQ(tree.erase(key), expected.erase(key) == 1);
+            break;
+        }
+    }
+    ASSERT_EQ(tree.size(), expected.size());
+    EXPECT_GT(tree.height(), 2);
+
+    auto it = expected.begin();
+    for (auto [key, value] : tree)
+    {
+        ASSERT_NE(it, expected.end());
+        EXPECT_EQ(key, it->first);
+        EXPECT_EQ(value, it->second);
+        ++it;
+    }
+    EXPECT_EQ(it, expected.end());
+    for (int key = -5'100; key <= 5'100; key += 7)
+    {
+        const int* value = tree.find(key);
+        auto found = expected.find(key);
+        ASSERT_EQ(value != nullptr, found != expected.end()) << key;
+        if (value)
+        {
+            EXPECT_EQ(*value, found->second);
+        }
+    }
+}
+
+TEST(SBTree, LowerBoundAndRange)
+{
+    svec::SBTree<int, int, 4> tree;
+    for (int key = 0; key < 1'000; key += 10)
+    {
+        tree.insert(key, key * 2);
+    }
+
+    auto it = tree.lowerBound(15);
+    EXPECT_EQ(it.key(), 20);
+    EXPECT_EQ(it.value(), 40);
+    EXPECT_EQ(tree.lowerBound(20).key(), 20);
+    EXPECT_EQ(tree.lowerBound(-5).key(), 0);
+    EXPECT_EQ(tree.lowerBound(991), tree.end());
+
+    std::vector<int> keys;
+    for (auto [key, value] : tree.range(95, 150))
+    {
+        keys.push_back(key);
+        value++;
+    }
+    EXPECT_EQ(keys, (std::vector<int>{100, 110, 120, 130, 140}));
+    EXPECT_EQ(*tree.find(100), 201) << "range should give mutable access to values";
+
+    const svec::SBTree<int, int, 4>& constTree = tree;
+    size_t count = 0;
+    for (auto [key, value] : constTree.range(0, 1'000))
+    {
+        EXPECT_EQ(value, key * 2 + (key >= 100 && key < 150));
+        count++;
+    }
+    EXPECT_EQ(count, 100);
+    EXPECT_EQ(constTree.range(500, 500).begin(), constTree.range(500, 500).end());
+}
+
+TEST(SBTree, EraseSkipsEmptyLeaves)
+{
+    svec::SBTree<int, int, 4> tree;
+    for (int key = 0; key < 100; key++)
+    {
+        tree.insert(key, key);
+    }
+    for (int key = 10; key < 90; key++)
+    {
+        EXPECT_TRUE(tree.erase(key));
+    }
+    EXPECT_FALSE(tree.erase(50));
+    EXPECT_EQ(tree.size(), 20);
+
+    auto it = tree.lowerBound(10);
+    EXPECT_EQ(it.key(), 90) << "lowerBound should move past emptied leaves";
+    std::vector<int> keys;
+    for (auto [key, value] : tree)
+    {
+        keys.push_back(key);
+    }
+    EXPECT_EQ(keys.size(), 20);
+    EXPECT_TRUE(std::is_sorted(keys.begin(), keys.end()));
+
+    EXPECT_TRUE(tree.insert(50, 5));
+    EXPECT_EQ(tree.lowerBound(11).key(), 50);
+}
+
+TEST(SBTree, BulkLoad)
+{
+    std::vector<std::pair<int, int>> sorted;
+    for (int key = 0; key < 10'000; key++)
+    {
+        sorted.emplace_back(key * 3, key);
+    }
+    svec::SBTree<int, int, 16> tree;
+    tree.insert(-1, -1);
+    tree.bulkLoad(sorted, 12);
+    EXPECT_EQ(tree.size(), sorted.size());
+    EXPECT_FALSE(tree.contains(-1)) << "bulkLoad should replace previous contents";
+    EXPECT_EQ(tree.height(), 4);
+
+    size_t i = 0;
+    for (auto [key, value] : tree)
+    {
+        EXPECT_EQ(key, sorted[i].first);
+        EXPECT_EQ(value, sorted[i].second);
+        i++;
+    }
+    EXPECT_EQ(i, sorted.size());
+    EXPECT_EQ(*tree.find(2'997), 999);
+    EXPECT_EQ(tree.find(2'998), nullptr);
+
+    for (int key = 1; key < 30'000; key += 3)
+    {
+        EXPECT_TRUE(tree.insert(key, -key));
+    }
+    EXPECT_EQ(tree.size(), 20'000);
+    EXPECT_EQ(*tree.find(2'998), -2'998);
+    EXPECT_EQ(tree.lowerBound(2).key(), 3);
+
+    tree.bulkLoad({});
+    EXPECT_TRUE(tree.empty());
+    EXPECT_EQ(tree.begin(), tree.end());
+}
+
+TEST(SBTree, UnsignedKeysAcrossSignBit)
+{
+    svec::SBTree<uint32_t, int, 8> tree;
+    std::vector<uint32_t> keys = {0, 1, 0x7FFF'FFFF, 0x8000'0000, 0x8000'0001, 0xFFFF'FFFE, 0xFFFF'FFFF};
+    for (size_t i = 0; i < 50; i++)
+    {
+        keys.push_back(0x7FFF'FFC0 + i);
+    }
+    for (uint32_t key : keys)
+    {
+        tree.insert(key, static_cast<int>(key & 0xFF));
+    }
+    std::sort(keys.begin(), keys.end());
+
+    size_t i = 0;
+    for (auto [key, value] : tree)
+    {
+        EXPECT_EQ(key, keys[i++]);
+    }
+    for (uint32_t key : keys)
+    {
+        EXPECT_TRUE(tree.contains(key)) << key;
+    }
+    EXPECT_EQ(tree.lowerBound(0x8000'0000).key(), 0x8000'0000u);
+    EXPECT_EQ(tree.lowerBound(0x8000'0002).key(), 0xFFFF'FFFEu);
+}
+
+TEST(SBTree, StringKeys)
+{
+    svec::SBTree<std::string, int> tree;
+    std::map<std::string, int> expected;
+    for (int i = 0; i < 2'000; i++)
+    {
+        std::string key = "key" + std::to_string(i * 7919 % 2'000);
+        tree.insert(key, i);
+        expected.emplace(key, i);
+    }
+    EXPECT_EQ(tree.size(), expected.size());
+    auto it = expected.begin();
+    for (auto [key, value] : tree)
+    {
+        EXPECT_EQ(key, it->first);
+        EXPECT_EQ(value, it->second);
+        ++it;
+    }
+    EXPECT_EQ(tree.lowerBound("key5").key(), "key5");
+    EXPECT_EQ(tree.lowerBound("key10000").key(), "key1001");
+    EXPECT_EQ(tree.lowerBound("key9999"), tree.end());
+}
+
+TEST(SBTree, ClearReusesNodes)
+{
+    svec::SBTree<int, int, 4> tree;
+    for (int key = 0; key < 1'000; key++)
+    {
+        tree.insert(key, key);
+    }
+    size_t nodes = tree.nodes();
+    tree.clear();
+    EXPECT_TRUE(tree.empty());
+    EXPECT_EQ(tree.height(), 1);
+    EXPECT_EQ(tree.nodes(), 1);
+    EXPECT_EQ(tree.begin(), tree.end());
+    for (int key = 0; key < 1'000; key++)
+    {
+        tree.insert(key, key);
+    }
+    EXPECT_EQ(tree.nodes(), nodes);
+}
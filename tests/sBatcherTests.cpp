@@ -0,0 +1,129 @@
+// Copyright 2025 Dalton Prokosch
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gtest/gtest.h"
+#include "sBatcher.hpp"
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+using Sink = std::function<void(std::span<int>)>;
+
+TEST(SBatcher, FlushesWhenFull)
+{
+    std::vector<std::vector<int>> batches;
+    svec::SBatcher<int, 4, Sink> batcher([&](std::span<int> batch) { batches.emplace_back(batch.begin(), batch.end()); });
+    for (int i = 0; i < 10; i++)
+    {
+        batcher.push(i);
+    }
+    ASSERT_EQ(batches.size(), 2);
+    EXPECT_EQ(batches[0], std::vector<int>({0, 1, 2, 3}));
+    EXPECT_EQ(batches[1], std::vector<int>({4, 5, 6, 7}));
+    EXPECT_EQ(batcher.size(), 2);
+
+    batcher.flush();
+    ASSERT_EQ(batches.size(), 3);
+    EXPECT_EQ(batches[2], std::vector<int>({8, 9}));
+    EXPECT_EQ(batcher.size(), 0);
+
+    batcher.flush();
+    EXPECT_EQ(batches.size(), 3) << "Empty batch should not reach sink";
+}
+
+TEST(SBatcher, SizeThreshold)
+{
+    size_t flushes = 0;
+    svec::SBatcher<int, 64, Sink> batcher([&](std::span<int> batch) { EXPECT_EQ(batch.size(), 3); flushes++; }, 3);
+    for (int i = 0; i < 9; i++)
+    {
+        batcher.push(i);
+    }
+    EXPECT_EQ(flushes, 3);
+}
+
+TEST(SBatcher, TimeThreshold)
+{
+    size_t flushed = 0;
+    svec::SBatcher<int, 64, Sink> batcher([&](std::span<int> batch) { flushed += batch.size(); }, 64, std::chrono::milliseconds(20));
+    batcher.push(1);
+    EXPECT_FALSE(batcher.poll()) << "Batch should not be flushed before delay";
+    std::this_thread::sleep_for(std::chrono::milliseconds(30));
+    EXPECT_TRUE(batcher.poll());
+    EXPECT_EQ(flushed, 1);
+
+    batcher.push(2);
+    std::this_thread::sleep_for(std::chrono::milliseconds(30));
+    batcher.push(3);
+    EXPECT_EQ(flushed, 3) << "Push should flush once oldest element is older than delay";
+}
+
+TEST(SBatcher, DestructorFlushes)
+{
+    std::vector<int> received;
+    {
+        svec::SBatcher<int, 8, Sink> batcher([&](std::span<int> batch) { received.insert(received.end(), batch.begin(), batch.end()); });
+        batcher.push(1);
+        batcher.push(2);
+    }
+    EXPECT_EQ(received, std::vector<int>({1, 2}));
+}
+
+TEST(SBatcher, MoveOnlyElements)
+{
+    int sum = 0;
+    auto sink = [&](std::span<std::unique_ptr<int>> batch)
+    {
+        for (std::unique_ptr<int>& element : batch)
+        {
+            sum += *element;
+        }
+    };
+    svec::SBatcher<std::unique_ptr<int>, 2, decltype(sink)> batcher(sink);
+    batcher.push(std::make_unique<int>(1));
+    batcher.emplace(new int(2));
+    batcher.emplace(new int(3));
+    EXPECT_EQ(sum, 3);
+    batcher.flush();
+    EXPECT_EQ(sum, 6);
+}
+
+TEST(SBatcher, BackgroundDrainKeepsOrder)
+{
+    std::vector<int> received;
+    std::thread::id producer = std::this_thread::get_id();
+    bool ranOnProducer = false;
+    {
+        svec::SBatcher<int, 64, Sink, true> batcher([&](std::span<int> batch)
+        {
+            ranOnProducer |= std::this_thread::get_id() == producer;
+            received.insert(received.end(), batch.begin(), batch.end());
+        });
+        for (int i = 0; i < 10000; i++)
+        {
+            batcher.push(i);
+        }
+        batcher.flush();
+        batcher.wait();
+        EXPECT_EQ(received.size(), 10000);
+        batcher.push(10000);
+    }
+    ASSERT_EQ(received.size(), 10001) << "Destructor should flush and drain remaining elements";
+    EXPECT_FALSE(ranOnProducer) << "Sink should run on background thread";
+    for (int i = 0; i <= 10000; i++)
+    {
+        ASSERT_EQ(received[i], i);
+    }
+}
@@ -0,0 +1,138 @@
+// Copyright 2025 Dalton Prokosch
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gtest/gtest.h"
+#include "sConcurrentAppendVector.hpp"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+TEST(SConcurrentAppendVector, SingleThreaded)
+{
+    svec::SConcurrentAppendVector<int, 4> SVector;
+    EXPECT_TRUE(SVector.pushBack(1));
+    EXPECT_TRUE(SVector.emplaceBack(2));
+    EXPECT_EQ(SVector.size(), 2);
+    EXPECT_EQ(SVector[1], 2);
+
+    EXPECT_TRUE(SVector.pushBack(3));
+    EXPECT_TRUE(SVector.pushBack(4));
+    EXPECT_FALSE(SVector.pushBack(5)) << "Full container should reject elements";
+
+    const svec::SVector<int, 4>& sealed = SVector.seal();
+    svec::SVector<int, 4> expected({1, 2, 3, 4});
+    EXPECT_EQ(sealed, expected);
+}
+
+TEST(SConcurrentAppendVector, ManyWriters)
+{
+    constexpr size_t THREADS = 8;
+    constexpr size_t PER_THREAD = 2000;
+    svec::SConcurrentAppendVector<size_t, THREADS * PER_THREAD> SVector;
+
+    std::vector<std::thread> writers;
+    for (size_t t = 0; t < THREADS; t++)
+    {
+        writers.emplace_back([&SVector, t]()
+        {
+            for (size_t i = 0; i < PER_THREAD; i++)
+            {
+                EXPECT_TRUE(SVector.pushBack(t * PER_THREAD + i));
+            }
+        });
+    }
+    for (std::thread& writer : writers)
+    {
+        writer.join();
+    }
+
+    const auto& sealed = SVector.seal();
+    ASSERT_EQ(sealed.size(), THREADS * PER_THREAD);
+    std::vector<size_t> values(sealed.begin(), sealed.end());
+    std::sort(values.begin(), values.end());
+    for (size_t i = 0; i < values.size(); i++)
+    {
+        ASSERT_EQ(values[i], i) << "Element lost or duplicated";
+    }
+}
+
+TEST(SConcurrentAppendVector, ReaderSeesOnlyPublishedElements)
+{
+    constexpr size_t THREADS = 4;
+    constexpr size_t PER_THREAD = 2000;
+    svec::SConcurrentAppendVector<std::string, THREADS * PER_THREAD> SVector;
+    std::atomic<bool> done{false};
+
+    std::thread reader([&]()
+    {
+        size_t lastSize = 0;
+        while (!done.load())
+        {
+            std::span<const std::string> published = SVector.published();
+            EXPECT_GE(published.size(), lastSize) << "Published prefix should only grow";
+            lastSize = published.size();
+            for (const std::string& element : published)
+            {
+                ASSERT_EQ(element.size(), 40) << "Read an element that was not fully constructed";
+            }
+        }
+    });
+    std::vector<std::thread> writers;
+    for (size_t t = 0; t < THREADS; t++)
+    {
+        writers.emplace_back([&SVector]()
+        {
+            for (size_t i = 0; i < PER_THREAD; i++)
+            {
+                SVector.emplaceBack(40, 'x');
+            }
+        });
+    }
+    for (std::thread& writer : writers)
+    {
+        writer.join();
+    }
+    done.store(true);
+    reader.join();
+
+    EXPECT_EQ(SVector.size(), THREADS * PER_THREAD);
+    EXPECT_EQ(SVector.seal().size(), THREADS * PER_THREAD);
+}
+
+TEST(SConcurrentAppendVector, OverflowFromManyThreads)
+{
+    svec::SConcurrentAppendVector<int, 100> SVector;
+    std::atomic<size_t> rejected{0};
+    std::vector<std::thread> writers;
+    for (int t = 0; t < 4; t++)
+    {
+        writers.emplace_back([&]()
+        {
+            for (int i = 0; i < 50; i++)
+            {
+                if (!SVector.pushBack(i))
+                {
+                    rejected++;
+                }
+            }
+        });
+    }
+    for (std::thread& writer : writers)
+    {
+        writer.join();
+    }
+    EXPECT_EQ(rejected.load(), 100);
+    EXPECT_EQ(SVector.seal().size(), 100);
+}
@@ -0,0 +1,133 @@
+// Copyright 2025 Dalton Prokosch
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gtest/gtest.h"
+#include "sExpression.hpp"
+
+#include <random>
+
+namespace
+{
+
+template<typename T, size_t CAPACITY>
+svec::SVector<T, CAPACITY> makeRandom(size_t size, uint32_t seed)
+{
+    std::mt19937 random(seed);
+    std::uniform_real_distribution<double> values(-100.0, 100.0);
+    svec::SVector<T, CAPACITY> vec;
+    for (size_t i = 0; i < size; i++)
+    {
+        vec.pushBack(static_cast<T>(values(random)));
+    }
+    return vec;
+}
+
+}
+
+TEST(SExpression, FusedArithmetic)
+{
+    svec::SVector<float, 16> b = {1, 2, 3, 4, 5};
+    svec::SVector<float, 16> c = {10, 20, 30, 40, 50};
+    svec::SVector<float, 16> a;
+
+    a = b * 2.0f + c;
+    EXPECT_EQ(a, (svec::SVector<float, 16>{12, 24, 36, 48, 60}));
+    a = (c - b) / b;
+    EXPECT_EQ(a, (svec::SVector<float, 16>{9, 9, 9, 9, 9}));
+    a = -b + 1.0f;
+    EXPECT_EQ(a, (svec::SVector<float, 16>{0, -1, -2, -3, -4}));
+    a = 100.0f - c * c / 10.0f;
+    EXPECT_EQ(a, (svec::SVector<float, 16>{90, 60, 10, -60, -150}));
+
+    svec::SVector<float, 16> d = b * b;
+    EXPECT_EQ(d, (svec::SVector<float, 16>{1, 4, 9, 16, 25})) << "SVector should be constructible from an expression";
+}
+
+TEST(SExpression, SizeIsSmallestOperand)
+{
+    svec::SVector<int, 16> b = {1, 2, 3, 4, 5};
+    svec::SVector<int, 16> c = {1, 1, 1};
+    svec::SVector<int, 16> a = {9, 9, 9, 9, 9, 9, 9, 9};
+
+    a = b + c;
+    EXPECT_EQ(a, (svec::SVector<int, 16>{2, 3, 4}));
+    EXPECT_EQ((b * 3).size(), 5);
+}
+
+TEST(SExpression, AssignToOperand)
+{
+    svec::SVector<double, 16> a = {1, 2, 3, 4};
+    svec::SVector<double, 16> b = {4, 3, 2, 1};
+    a = a * 2.0 + b;
+    EXPECT_EQ(a, (svec::SVector<double, 16>{6, 7, 8, 9}));
+}
+
+TEST(SExpression, ElementwiseFunctions)
+{
+    svec::SVector<float, 16> x = {-3, -1, 0, 2, 5, 9};
+    svec::SVector<float, 16> out;
+
+    out = svec::clamp(x, -2.0f, 4.0f);
+    EXPECT_EQ(out, (svec::SVector<float, 16>{-2, -1, 0, 2, 4, 4}));
+    out = svec::abs(x);
+    EXPECT_EQ(out, (svec::SVector<float, 16>{3, 1, 0, 2, 5, 9}));
+    out = svec::sqrt(svec::abs(x) * svec::abs(x));
+    EXPECT_EQ(out, (svec::SVector<float, 16>{3, 1, 0, 2, 5, 9}));
+    out = svec::maximum(x, svec::minimum(x * 2.0f, 1.0f));
+    EXPECT_EQ(out, (svec::SVector<float, 16>{-3, -1, 0, 2, 5, 9}));
+
+    svec::SVector<int, 16> integers = {-7, 3, -2};
+    svec::SVector<int, 16> result = svec::abs(integers) * 2;
+    EXPECT_EQ(result, (svec::SVector<int, 16>{14, 6, 4}));
+}
+
+TEST(SExpression, ReductionsMatchReference)
+{
+    for (size_t size : {1, 2, 7, 8, 9, 63, 256, 1'000})
+    {
+        auto a = makeRandom<float, 1'024>(size, size);
+        auto b = makeRandom<float, 1'024>(size, size + 1);
+        float tolerance = 1e-3f * size;
+
+        EXPECT_NEAR(svec::sum(a), svec::reference::sum(a), tolerance) << size;
+        EXPECT_NEAR(svec::dot(a, b), svec::reference::dot(a, b), 100 * tolerance) << size;
+        EXPECT_NEAR(svec::norm(a), svec::reference::norm(a), tolerance) << size;
+        EXPECT_EQ(svec::min(a), svec::reference::min(a)) << size;
+        EXPECT_EQ(svec::max(a), svec::reference::max(a)) << size;
+        EXPECT_EQ(svec::argmax(a), svec::reference::argmax(a)) << size;
+        EXPECT_EQ(svec::max(a * -1.0f), -svec::min(a)) << size;
+
+        auto integers = makeRandom<int32_t, 1'024>(size, size + 2);
+        EXPECT_EQ(svec::sum(integers), svec::reference::sum(integers)) << size;
+        EXPECT_EQ(svec::sum(integers * integers), svec::reference::dot(integers, integers)) << size;
+        EXPECT_EQ(svec::argmax(integers), svec::reference::argmax(integers)) << size;
+    }
+    EXPECT_EQ(svec::sum(svec::SVector<float, 4>()), 0.0f);
+}
+
+TEST(SExpression, ArgmaxPrefersFirst)
+{
+    svec::SVector<int, 32> x;
+    x.resize(20, 1);
+    x[13] = 5;
+    x[17] = 5;
+    x[19] = 5;
+    EXPECT_EQ(svec::argmax(x), 13);
+    x[2] = 5;
+    EXPECT_EQ(svec::argmax(x), 2);
+    x.resize(3);
+    EXPECT_EQ(svec::argmax(x), 2);
+    x[0] = 5;
+    EXPECT_EQ(svec::argmax(x), 0);
+}
@@ -0,0 +1,148 @@
+// Copyright 2025 Dalton Prokosch
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gtest/gtest.h"
+#include "sHeap.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <vector>
+
+TEST(SHeap, PushPopOrdered)
+{
+    svec::SHeap<int, 16> SHeap;
+    for (int value : {5, 3, 8, 1, 9, 2, 7})
+    {
+        SHeap.push(value);
+    }
+    ASSERT_EQ(SHeap.size(), 7);
+
+    svec::SVector<int, 16> popped;
+    while (!SHeap.empty())
+    {
+        popped.pushBack(SHeap.top());
+        SHeap.pop();
+    }
+    svec::SVector<int, 16> expected({1, 2, 3, 5, 7, 8, 9});
+    EXPECT_EQ(popped, expected);
+}
+
+TEST(SHeap, InitializationListHeapifies)
+{
+    svec::SHeap<int, 16, std::greater<int>> SHeap({4, 1, 6, 3, 9, 2});
+    EXPECT_EQ(SHeap.top(), 9) << "std::greater should give a max heap";
+    SHeap.pop();
+    EXPECT_EQ(SHeap.top(), 6);
+}
+
+template<size_t ARITY>
+void checkRandomAgainstSort()
+{
+    std::mt19937 random(ARITY);
+    std::vector<int> values(500);
+    for (int& value : values)
+    {
+        value = static_cast<int>(random() % 1000);
+    }
+    svec::SHeap<int, 500, std::less<int>, ARITY> SHeap;
+    for (int value : values)
+    {
+        SHeap.push(value);
+    }
+    std::sort(values.begin(), values.end());
+    for (int value : values)
+    {
+        ASSERT_EQ(SHeap.top(), value) << "Arity " << ARITY;
+        SHeap.pop();
+    }
+}
+
+TEST(SHeap, RandomMatchesSortForAllArities)
+{
+    checkRandomAgainstSort<2>();
+    checkRandomAgainstSort<3>();
+    checkRandomAgainstSort<4>();
+    checkRandomAgainstSort<8>();
+}
+
+TEST(SHeap, DecreaseKey)
+{
+    svec::SHeap<int, 16> SHeap({10, 20, 30, 40, 50});
+    size_t index = std::find(SHeap.begin(), SHeap.end(), 50) - SHeap.begin();
+
+    SHeap.decreaseKey(index, 5);
+    EXPECT_EQ(SHeap.top(), 5);
+    SHeap.pop();
+    EXPECT_EQ(SHeap.top(), 10);
+}
+
+TEST(SHeap, MoveOnlyEmplace)
+{
+    auto compare = [](const std::unique_ptr<int>& a, const std::unique_ptr<int>& b) { return *a < *b; };
+    svec::SHeap<std::unique_ptr<int>, 8, decltype(compare)> SHeap(compare);
+    SHeap.emplace(new int(3));
+    SHeap.push(std::make_unique<int>(1));
+    SHeap.emplace(new int(2));
+
+    EXPECT_EQ(*SHeap.top(), 1);
+    SHeap.pop();
+    EXPECT_EQ(*SHeap.top(), 2);
+}
+
+TEST(STopK, KeepsGreatest)
+{
+    svec::STopK<int, 3> topK;
+    for (int value : {4, 9, 1, 7, 3, 8, 2})
+    {
+        topK.push(value);
+    }
+    EXPECT_TRUE(topK.full());
+    EXPECT_EQ(topK.threshold(), 7);
+    EXPECT_FALSE(topK.push(6)) << "Value below threshold should be dropped";
+
+    svec::SVector<int, 3> expected({9, 8, 7});
+    EXPECT_EQ(topK.sorted(), expected);
+}
+
+TEST(STopK, StreamMatchesPartialSort)
+{
+    std::mt19937 random(50);
+    std::vector<unsigned> values(100000);
+    svec::STopK<unsigned, 50> topK;
+    for (unsigned& value : values)
+    {
+        value = random();
+        topK.push(value);
+    }
+    std::partial_sort(values.begin(), values.begin() + 50, values.end(), std::greater<unsigned>());
+
+    svec::SVector<unsigned, 50> sorted = topK.sorted();
+    ASSERT_EQ(sorted.size(), 50);
+    for (size_t i = 0; i < 50; i++)
+    {
+        EXPECT_EQ(sorted[i], values[i]);
+    }
+}
+
+TEST(STopK, FewerThanK)
+{
+    svec::STopK<int, 5, std::greater<int>> bottomK;
+    bottomK.push(3);
+    bottomK.push(1);
+
+    EXPECT_FALSE(bottomK.full());
+    svec::SVector<int, 5> expected({1, 3});
+    EXPECT_EQ(bottomK.sorted(), expected) << "std::greater should keep the smallest elements";
+}
@@ -0,0 +1,130 @@
+// Copyright 2025 Dalton Prokosch
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gtest/gtest.h"
+#include "sJaggedArray.hpp"
+
+#include <string>
+#include <vector>
+
+TEST(SJaggedArray, DefaultConstructor)
+{
+    svec::SJaggedArray<int, 64, 8> SJaggedArray;
+    EXPECT_EQ(SJaggedArray.rows(), 0);
+    EXPECT_EQ(SJaggedArray.size(), 0);
+    EXPECT_EQ(SJaggedArray.capacity(), 64);
+}
+
+TEST(SJaggedArray, AppendRows)
+{
+    svec::SJaggedArray<int, 64, 8> SJaggedArray;
+    SJaggedArray.appendRow({1, 2, 3});
+    SJaggedArray.appendRow();
+    SJaggedArray.appendRow();
+    SJaggedArray.pushBack(4);
+    SJaggedArray.emplaceBack(5);
+
+    ASSERT_EQ(SJaggedArray.rows(), 3);
+    EXPECT_EQ(SJaggedArray.size(), 5);
+    EXPECT_EQ(SJaggedArray.rowSize(0), 3);
+    EXPECT_EQ(SJaggedArray.rowSize(1), 0);
+    EXPECT_TRUE(SJaggedArray[1].empty());
+    EXPECT_EQ(SJaggedArray[2][0], 4);
+    EXPECT_EQ(SJaggedArray[2][1], 5);
+    EXPECT_EQ(SJaggedArray[0].data() + 3, SJaggedArray[2].data()) << "Rows should be stored contiguously";
+
+    SJaggedArray[0][1] = 20;
+    EXPECT_EQ(SJaggedArray.elements()[1], 20);
+
+    SJaggedArray.popRow();
+    EXPECT_EQ(SJaggedArray.rows(), 2);
+    EXPECT_EQ(SJaggedArray.size(), 3);
+
+    SJaggedArray.clear();
+    EXPECT_EQ(SJaggedArray.rows(), 0);
+    EXPECT_EQ(SJaggedArray.size(), 0);
+}
+
+TEST(SJaggedArray, CompactOffsets)
+{
+    EXPECT_EQ(sizeof(svec::SJaggedArray<int, 1000, 10>::OffsetType), 2);
+    EXPECT_EQ(sizeof(svec::SJaggedArray<int, 100000, 10>::OffsetType), 4);
+}
+
+TEST(SJaggedArray, AssignCountingSortIsStable)
+{
+    std::vector<std::pair<size_t, std::string>> pairs = {
+        {2, "c0"}, {0, "a0"}, {2, "c1"}, {3, "d0"}, {0, "a1"}, {2, "c2"}
+    };
+    svec::SJaggedArray<std::string, 16, 8> SJaggedArray;
+    SJaggedArray.appendRow({"stale"});
+    SJaggedArray.assign(pairs, 5);
+
+    ASSERT_EQ(SJaggedArray.rows(), 5);
+    ASSERT_EQ(SJaggedArray.size(), 6);
+    EXPECT_EQ(SJaggedArray.rowSize(0), 2);
+    EXPECT_EQ(SJaggedArray.rowSize(1), 0);
+    EXPECT_EQ(SJaggedArray.rowSize(2), 3);
+    EXPECT_EQ(SJaggedArray.rowSize(3), 1);
+    EXPECT_EQ(SJaggedArray.rowSize(4), 0);
+
+    EXPECT_EQ(SJaggedArray[0][0], "a0");
+    EXPECT_EQ(SJaggedArray[0][1], "a1");
+    EXPECT_EQ(SJaggedArray[2][0], "c0");
+    EXPECT_EQ(SJaggedArray[2][1], "c1");
+    EXPECT_EQ(SJaggedArray[2][2], "c2");
+    EXPECT_EQ(SJaggedArray[3][0], "d0");
+}
+
+TEST(SJaggedArray, AdjacencyBreadthFirstSearch)
+{
+    // 0 -> 1, 2; 1 -> 3; 2 -> 3; 3 -> 4
+    std::vector<std::pair<size_t, int>> edges = {{0, 1}, {1, 3}, {0, 2}, {2, 3}, {3, 4}};
+    svec::SJaggedArray<int, 32, 8> graph;
+    graph.assign(edges, 5);
+
+    svec::SVector<int, 8> distance({-1, -1, -1, -1, -1});
+    svec::SVector<int, 8> queue({0});
+    distance[0] = 0;
+    for (size_t head = 0; head < queue.size(); head++)
+    {
+        int node = queue[head];
+        for (int neighbour : graph[node])
+        {
+            if (distance[neighbour] == -1)
+            {
+                distance[neighbour] = distance[node] + 1;
+                queue.pushBack(neighbour);
+            }
+        }
+    }
+    svec::SVector<int, 8> expected({0, 1, 1, 2, 3});
+    EXPECT_EQ(distance, expected);
+}
+
+#ifdef _DEBUG
+TEST(SJaggedArray, NoOpenRowThrows)
+{
+    svec::SJaggedArray<int, 64, 8> SJaggedArray;
+    EXPECT_THROW(SJaggedArray.pushBack(1), std::out_of_range);
+    EXPECT_THROW(SJaggedArray.emplaceBack(1), std::out_of_range);
+    EXPECT_THROW(SJaggedArray.popRow(), std::out_of_range);
+    EXPECT_EQ(SJaggedArray.size(), 0);
+
+    SJaggedArray.appendRow({1, 2});
+    SJaggedArray.popRow();
+    EXPECT_THROW(SJaggedArray.popRow(), std::out_of_range);
+    EXPECT_EQ(SJaggedArray.rows(), 0);
+}
+#endif // _DEBUG end
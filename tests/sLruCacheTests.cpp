@@ -0,0 +1,171 @@
+// Copyright 2025 Dalton Prokosch
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gtest/gtest.h"
+#include "sLruCache.hpp"
+
+#include <list>
+#include <random>
+#include <string>
+#include <unordered_map>
+
+TEST(SLruCache, PutAndGet)
+{
+    svec::SLruCache<int, std::string, 4> cache;
+    EXPECT_EQ(cache.get(1), nullptr);
+
+    cache.put(1, "one");
+    cache.put(2, "two");
+    ASSERT_NE(cache.get(1), nullptr);
+    EXPECT_EQ(*cache.get(1), "one");
+    EXPECT_EQ(*cache.get(2), "two");
+    EXPECT_EQ(cache.size(), 2);
+
+    cache.put(1, "uno");
+    EXPECT_EQ(*cache.get(1), "uno") << "Putting an existing key should replace its value";
+    EXPECT_EQ(cache.size(), 2);
+}
+
+TEST(SLruCache, EvictsLeastRecentlyUsed)
+{
+    svec::SLruCache<int, int, 3> cache;
+    cache.put(1, 10);
+    cache.put(2, 20);
+    cache.put(3, 30);
+    cache.get(1);
+    cache.put(4, 40);
+
+    EXPECT_FALSE(cache.contains(2)) << "2 was least recently used";
+    EXPECT_TRUE(cache.contains(1));
+    EXPECT_TRUE(cache.contains(3));
+    EXPECT_TRUE(cache.contains(4));
+    EXPECT_EQ(cache.size(), 3);
+    EXPECT_EQ(cache.mostRecent().key, 4);
+    EXPECT_EQ(cache.leastRecent().key, 3);
+
+    EXPECT_EQ(*cache.peek(3), 30);
+    EXPECT_EQ(cache.leastRecent().key, 3) << "peek should not change recency";
+}
+
+TEST(SLruCache, EraseKeepsEntriesLinked)
+{
+    svec::SLruCache<int, int, 4> cache;
+    for (int key = 1; key <= 4; key++)
+    {
+        cache.put(key, key * 10);
+    }
+    EXPECT_TRUE(cache.erase(2));
+    EXPECT_FALSE(cache.erase(2));
+    EXPECT_EQ(cache.size(), 3);
+    EXPECT_EQ(*cache.get(4), 40) << "Last entry is moved into the erased slot";
+
+    cache.put(5, 50);
+    cache.put(6, 60);
+    EXPECT_FALSE(cache.contains(1));
+    EXPECT_TRUE(cache.contains(3));
+
+    cache.clear();
+    EXPECT_EQ(cache.size(), 0);
+    EXPECT_FALSE(cache.contains(3));
+    cache.put(7, 70);
+    EXPECT_EQ(cache.leastRecent().key, 7);
+}
+
+struct CollidingHash
+{
+    size_t operator()(int) const
+    {
+        return 0;
+    }
+};
+
+TEST(SLruCache, CollidingKeys)
+{
+    svec::SLruCache<int, int, 8, CollidingHash> cache;
+    for (int key = 0; key < 8; key++)
+    {
+        cache.put(key, key);
+    }
+    EXPECT_TRUE(cache.erase(3));
+    EXPECT_TRUE(cache.erase(0));
+    for (int key = 0; key < 8; key++)
+    {
+        EXPECT_EQ(cache.contains(key), key != 0 && key != 3) << "Probe run should survive removals, key " << key;
+    }
+    cache.put(20, 20);
+    cache.put(21, 21);
+    cache.put(22, 22);
+    EXPECT_FALSE(cache.contains(1)) << "Oldest remaining key should be evicted";
+    EXPECT_EQ(*cache.get(22), 22);
+}
+
+TEST(SLruCache, RandomAgainstReference)
+{
+    constexpr size_t CAPACITY = 64;
+    svec::SLruCache<uint32_t, uint32_t, CAPACITY> cache;
+    std::list<std::pair<uint32_t, uint32_t>> order;
+    std::unordered_map<uint32_t, std::list<std::pair<uint32_t, uint32_t>>::iterator> index;
+
+    std::mt19937 random(37);
+    for (int i = 0; i < 20000; i++)
+    {
+        uint32_t key = random() % 200;
+        uint32_t operation = random() % 10;
+        auto found = index.find(key);
+        if (operation < 5)
+        {
+            uint32_t* value = cache.get(key);
+            ASSERT_EQ(value != nullptr, found != index.end()) << "Mismatch at operation " << i;
+            if (value)
+            {
+                ASSERT_EQ(*value, found->second->second);
+                order.splice(order.begin(), order, found->second);
+            }
+        }
+        else if (operation < 9)
+        {
+            cache.put(key, i);
+            if (found != index.end())
+            {
+                found->second->second = i;
+                order.splice(order.begin(), order, found->second);
+            }
+            else
+            {
+                if (order.size() == CAPACITY)
+                {
+                    index.erase(order.back().first);
+                    order.pop_back();
+                }
+                order.emplace_front(key, i);
+                index[key] = order.begin();
+            }
+        }
+        else
+        {
+            ASSERT_EQ(cache.erase(key), found != index.end());
+            if (found != index.end())
+            {
+                order.erase(found->second);
+                index.erase(found);
+            }
+        }
+        ASSERT_EQ(cache.size(), order.size());
+        if (!order.empty())
+        {
+            ASSERT_EQ(cache.mostRecent().key, order.front().first);
+            ASSERT_EQ(cache.leastRecent().key, order.back().first);
+        }
+    }
+}
@@ -0,0 +1,269 @@
+// Copyright 2025 Dalton Prokosch
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gtest/gtest.h"
+#include "sMappedVector.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <string>
+#include <type_traits>
+
+/**
+ * @brief Temporary file path removed at end of test
+ * 
+ */
+struct TempPath
+{
+    TempPath()
+    {
+        char name[] = "/tmp/sMappedVectorTestsXXXXXX";
+        int fd = mkstemp(name);
+        close(fd);
+        unlink(name);
+        path = name;
+    }
+    ~TempPath()
+    {
+        unlink(path.c_str());
+    }
+    std::string path;
+};
+
+TEST(SMappedVector, AnonymousLargeCapacity)
+{
+    svec::SMappedVector<int, 10'000'000> SVector;
+    EXPECT_EQ(SVector.size(), 0);
+    EXPECT_EQ(SVector.capacity(), 10'000'000);
+
+    SVector.pushBack(1);
+    SVector.emplaceBack(3);
+    SVector.insert(1, 2);
+    SVector.data()[9'999] = 0;
+    ASSERT_EQ(SVector.size(), 3);
+    EXPECT_EQ(SVector[0], 1);
+    EXPECT_EQ(SVector[1], 2);
+    EXPECT_EQ(SVector.back(), 3);
+
+    SVector.erase(0);
+    EXPECT_EQ(SVector.front(), 2);
+    SVector.popBack();
+    EXPECT_EQ(SVector.size(), 1);
+
+    SVector.resizeForOverwrite(10'000'000);
+    std::iota(SVector.begin(), SVector.end(), 0);
+    EXPECT_EQ(SVector.back(), 9'999'999);
+}
+
+TEST(SMappedVector, FrontOperationsAndEquality)
+{
+    svec::SMappedVector<int, 64> SVector;
+    SVector.pushFront(3);
+    SVector.emplaceFront(1);
+    SVector.emplace(1, 2);
+    int four = 4;
+    SVector.pushBack(std::move(four));
+    EXPECT_TRUE(SVector == (std::initializer_list<int>{1, 2, 3, 4}));
+    EXPECT_TRUE(SVector == (svec::SVector<int, 8>{1, 2, 3, 4}));
+
+    SVector.popFront();
+    EXPECT_EQ(SVector.front(), 2);
+    SVector.emplaceFront(SVector.back());
+    svec::SMappedVector<int, 16> other;
+    for (int value : {4, 2, 3, 4})
+    {
+        other.pushBack(value);
+    }
+    EXPECT_TRUE(SVector == other);
+    other.popBack();
+    EXPECT_FALSE(SVector == other);
+
+    svec::SMappedVector<int, 64>::ConstIterator it = std::as_const(SVector).begin();
+    EXPECT_EQ(std::distance(it, std::as_const(SVector).end()), 4);
+}
+
+/**
+ * @brief Trivially copyable type that can only be moved
+ * 
+ */
+struct MoveOnly
+{
+    MoveOnly(int value) : value{value} {}
+    MoveOnly(MoveOnly&&) = default;
+    MoveOnly& operator=(MoveOnly&&) = default;
+    int value;
+};
+
+TEST(SMappedVector, MoveOnlyElements)
+{
+    svec::SMappedVector<MoveOnly, 16> SVector;
+    MoveOnly a(1);
+    MoveOnly b(3);
+    MoveOnly c(2);
+    MoveOnly d(0);
+    SVector.pushBack(std::move(a));
+    SVector.pushBack(std::move(b));
+    SVector.insert(1, std::move(c));
+    SVector.pushFront(std::move(d));
+    SVector.emplace(4, 4);
+    ASSERT_EQ(SVector.size(), 5);
+    for (int i = 0; i < 5; i++)
+    {
+        EXPECT_EQ(SVector[i].value, i);
+    }
+}
+
+TEST(SMappedVector, Alignment)
+{
+    svec::SMappedVector<double, 16> SVector;
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(SVector.data()) % svec::CACHE_LINE_SIZE, 0);
+}
+
+TEST(SMappedVector, FilePersistsAcrossReopen)
+{
+    TempPath temp;
+    {
+        svec::SMappedVector<uint64_t, 100000> SVector(temp.path.c_str());
+        EXPECT_EQ(SVector.size(), 0);
+        for (uint64_t i = 0; i < 1000; i++)
+        {
+            SVector.pushBack(i * i);
+        }
+        SVector.checkpoint();
+    }
+    svec::SMappedVector<uint64_t, 100000> reopened(temp.path.c_str());
+    ASSERT_EQ(reopened.size(), 1000);
+    for (uint64_t i = 0; i < 1000; i++)
+    {
+        ASSERT_EQ(reopened[i], i * i);
+    }
+    reopened.pushBack(7);
+    reopened.checkpoint(true);
+}
+
+TEST(SMappedVector, ReadOnlySharedMapping)
+{
+    TempPath temp;
+    {
+        svec::SMappedVector<int, 64> SVector(temp.path.c_str());
+        SVector.pushBack(4);
+        SVector.pushBack(2);
+    }
+    svec::SMappedVector<int, 64> readerA(temp.path.c_str(), {.readOnly = true});
+    svec::SMappedVector<int, 64> readerB(temp.path.c_str(), {.readOnly = true});
+    ASSERT_EQ(readerA.size(), 2);
+    EXPECT_EQ(readerA[0], 4);
+    EXPECT_EQ(readerB[1], 2);
+
+    svec::SMappedVector<int, 64> writer(temp.path.c_str());
+    writer[0] = 8;
+    EXPECT_EQ(readerA[0], 8) << "Shared mappings should see writes from other mappings of the file";
+}
+
+#ifdef _DEBUG
+TEST(SMappedVector, ReadOnlyMutationThrows)
+{
+    TempPath temp;
+    {
+        svec::SMappedVector<int, 64> SVector(temp.path.c_str());
+        SVector.pushBack(4);
+        SVector.pushBack(2);
+    }
+    svec::SMappedVector<int, 64> reader(temp.path.c_str(), {.readOnly = true});
+    EXPECT_THROW(reader.pushBack(1), std::logic_error);
+    EXPECT_THROW(reader.popBack(), std::logic_error);
+    EXPECT_THROW(reader.erase(0), std::logic_error);
+    EXPECT_THROW(reader.clear(), std::logic_error);
+    EXPECT_TRUE(reader == (std::initializer_list<int>{4, 2}));
+}
+#endif // _DEBUG end
+
+TEST(SMappedVector, RejectsMismatchedFiles)
+{
+    TempPath temp;
+    {
+        svec::SMappedVector<int, 64> SVector(temp.path.c_str());
+    }
+    EXPECT_THROW((svec::SMappedVector<float, 64>(temp.path.c_str())), std::runtime_error) << "Different type with same size should be rejected";
+    EXPECT_THROW((svec::SMappedVector<int, 65>(temp.path.c_str())), std::runtime_error) << "Different capacity should be rejected";
+    EXPECT_THROW((svec::SMappedVector<uint32_t, 64>(temp.path.c_str())), std::runtime_error) << "Different signedness should be rejected";
+    EXPECT_THROW((svec::SMappedVector<int, 64>(temp.path.c_str(), {.typeTag = 1})), std::runtime_error) << "Different type tag should be rejected";
+    EXPECT_THROW((svec::SMappedVector<int, 64>("/nonexistent/directory/file")), std::system_error);
+}
+
+TEST(SMappedVector, TypeTag)
+{
+    TempPath temp;
+    {
+        svec::SMappedVector<int, 64> SVector(temp.path.c_str(), {.typeTag = 42});
+        SVector.pushBack(9);
+    }
+    EXPECT_THROW((svec::SMappedVector<int, 64>(temp.path.c_str())), std::runtime_error);
+    svec::SMappedVector<int, 64> reopened(temp.path.c_str(), {.readOnly = true, .typeTag = 42});
+    EXPECT_TRUE(reopened == (std::initializer_list<int>{9}));
+    EXPECT_EQ(svec::typeFingerprint<int>(), svec::typeFingerprint<int>(0));
+    EXPECT_NE(svec::typeFingerprint<int>(), svec::typeFingerprint<float>());
+}
+
+TEST(SMappedVector, AdviseHugePagesAndMove)
+{
+    svec::SMappedVector<int, 1 << 20> SVectorA({.adviseHugePages = true});
+    SVectorA.pushBack(5);
+
+    svec::SMappedVector<int, 1 << 20> SVectorB(std::move(SVectorA));
+    EXPECT_EQ(SVectorB.size(), 1);
+    EXPECT_EQ(SVectorB[0], 5);
+    EXPECT_EQ(SVectorA.size(), 0) << "moved from SMappedVector should be empty";
+
+    svec::SMappedVector<int, 1 << 20> SVectorC;
+    SVectorC.pushBack(6);
+    SVectorC = std::move(SVectorB);
+    ASSERT_EQ(SVectorC.size(), 1);
+    EXPECT_EQ(SVectorC[0], 5);
+    EXPECT_EQ(SVectorB.size(), 0) << "moved from SMappedVector should be empty";
+    static_assert(std::is_nothrow_move_constructible_v<svec::SMappedVector<int, 16>>);
+    static_assert(std::is_nothrow_move_assignable_v<svec::SMappedVector<int, 16>>);
+}
+
+TEST(SMappedVector, MovedFromOutlivesTarget)
+{
+    svec::SMappedVector<int, 64> source;
+    source.pushBack(1);
+    {
+        svec::SMappedVector<int, 64> target(std::move(source));
+        EXPECT_EQ(target.size(), 1);
+    }
+    EXPECT_EQ(source.size(), 0);
+    EXPECT_EQ(source.begin(), source.end());
+
+    svec::SMappedVector<int, 64> assigned;
+    {
+        svec::SMappedVector<int, 64> target;
+        target = std::move(assigned);
+    }
+    EXPECT_EQ(assigned.size(), 0);
+}
+
+#ifdef _DEBUG
+TEST(SMappedVector, PushOntoFullThrows)
+{
+    svec::SMappedVector<int, 4> SVector;
+    SVector.resizeForOverwrite(4);
+    EXPECT_THROW(SVector.pushBack(1), std::out_of_range);
+    EXPECT_THROW(SVector.emplaceBack(1), std::out_of_range);
+    EXPECT_THROW(SVector.pushFront(1), std::out_of_range);
+    EXPECT_THROW(SVector.insert(2, 1), std::out_of_range);
+    EXPECT_EQ(SVector.size(), 4);
+}
+#endif // _DEBUG end
@@ -0,0 +1,193 @@
+// Copyright 2025 Dalton Prokosch
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gtest/gtest.h"
+#include "sParallel.hpp"
+#include "sMappedVector.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+constexpr size_t SIZE = 300'000;
+using Vector = svec::SVector<int64_t, SIZE>;
+
+/**
+ * @brief Lowers the sequential cutoff for a test so small inputs take the parallel paths
+ */
+class Cutoff
+{
+public:
+    explicit Cutoff(size_t cutoff) :
+        m_previous{svec::parallel::sequentialCutoff()}
+    {
+        svec::parallel::setSequentialCutoff(cutoff);
+    }
+    ~Cutoff()
+    {
+        svec::parallel::setSequentialCutoff(m_previous);
+    }
+
+private:
+    size_t m_previous;
+};
+
+std::unique_ptr<Vector> randomVector(size_t size, int64_t range)
+{
+    std::mt19937_64 random(size);
+    std::unique_ptr<Vector> vec = std::make_unique<Vector>();
+    for (size_t i = 0; i < size; i++)
+    {
+        vec->pushBack(static_cast<int64_t>(random() % range));
+    }
+    return vec;
+}
+
+}
+
+TEST(Parallel, Sort)
+{
+    svec::SThreadPool pool(3);
+    for (int64_t range : {int64_t{2}, int64_t{1000}, INT64_MAX})
+    {
+        for (size_t size : {size_t{0}, size_t{1000}, SIZE})
+        {
+            std::unique_ptr<Vector> vec = randomVector(size, range);
+            std::vector<int64_t> expected(vec->data(), vec->data() + vec->size());
+            std::sort(expected.begin(), expected.end());
+            svec::parallel::sort(pool, *vec);
+            EXPECT_TRUE(std::equal(expected.begin(), expected.end(), vec->begin(), vec->end()));
+        }
+    }
+
+    // already sorted and reversed inputs
+    std::unique_ptr<Vector> vec = randomVector(SIZE, INT64_MAX);
+    svec::parallel::sort(pool, *vec, std::greater<>());
+    EXPECT_TRUE(std::is_sorted(vec->begin(), vec->end(), std::greater<>()));
+    svec::parallel::sort(pool, *vec);
+    EXPECT_TRUE(std::is_sorted(vec->begin(), vec->end()));
+    svec::parallel::sort(pool, *vec);
+    EXPECT_TRUE(std::is_sorted(vec->begin(), vec->end()));
+}
+
+TEST(Parallel, TransformAndForEach)
+{
+    svec::SThreadPool pool(3);
+    std::unique_ptr<Vector> vec = randomVector(SIZE, 1000);
+    std::unique_ptr<svec::SVector<double, SIZE>> halves = std::make_unique<svec::SVector<double, SIZE>>();
+    svec::parallel::transform(pool, *vec, *halves, [](int64_t value) { return value * 0.5; });
+    ASSERT_EQ(halves->size(), SIZE);
+    for (size_t i = 0; i < SIZE; i++)
+    {
+        ASSERT_EQ((*halves)[i], (*vec)[i] * 0.5);
+    }
+
+    std::unique_ptr<Vector> copy = std::make_unique<Vector>(*vec);
+    svec::parallel::forEach(pool, *vec, [](int64_t& value) { value = value * 3 + 1; });
+    svec::parallel::transform(pool, *copy, *copy, [](int64_t value) { return value * 3 + 1; });
+    EXPECT_TRUE(*vec == *copy);
+}
+
+TEST(Parallel, Reduce)
+{
+    svec::SThreadPool pool(3);
+    std::unique_ptr<Vector> vec = randomVector(SIZE, 1'000'000);
+    int64_t expected = std::accumulate(vec->begin(), vec->end(), int64_t{7});
+    EXPECT_EQ(svec::parallel::reduce(pool, *vec, int64_t{7}), expected);
+    EXPECT_EQ(svec::parallel::reduce(pool, *vec, int64_t{INT64_MIN}, [](int64_t a, int64_t b) { return std::max(a, b); }),
+              *std::max_element(vec->begin(), vec->end()));
+    EXPECT_EQ(svec::parallel::reduce(pool, svec::SVector<int64_t, 4>(), int64_t{7}), 7);
+
+    // order is kept, so an associative but not commutative op matches a sequential fold
+    Cutoff cutoff(1);
+    svec::SVector<std::string, 5000> words;
+    std::string concatenated;
+    for (size_t i = 0; i < 5000; i++)
+    {
+        words.pushBack(std::to_string(i % 10));
+        concatenated += words.back();
+    }
+    EXPECT_EQ(svec::parallel::reduce(pool, words, std::string(">")), ">" + concatenated);
+}
+
+TEST(Parallel, InclusiveScan)
+{
+    svec::SThreadPool pool(3);
+    for (size_t size : {size_t{0}, size_t{1}, size_t{5000}, SIZE})
+    {
+        std::unique_ptr<Vector> vec = randomVector(size, 1000);
+        std::vector<int64_t> expected(vec->size());
+        std::inclusive_scan(vec->begin(), vec->end(), expected.begin());
+        std::unique_ptr<Vector> out = std::make_unique<Vector>();
+        svec::parallel::inclusiveScan(pool, *vec, *out);
+        EXPECT_TRUE(std::equal(expected.begin(), expected.end(), out->begin(), out->end()));
+        svec::parallel::inclusiveScan(pool, *vec, *vec);
+        EXPECT_TRUE(std::equal(expected.begin(), expected.end(), vec->begin(), vec->end()));
+    }
+
+    Cutoff cutoff(1);
+    svec::SVector<std::string, 5000> words;
+    for (size_t i = 0; i < 5000; i++)
+    {
+        words.pushBack(std::to_string(i % 10));
+    }
+    svec::SVector<std::string, 5000> prefixes;
+    svec::parallel::inclusiveScan(pool, words, prefixes);
+    ASSERT_EQ(prefixes.size(), 5000);
+    EXPECT_EQ(prefixes[0], "0");
+    EXPECT_EQ(prefixes[12], "0123456789012");
+    EXPECT_EQ(prefixes[4999].size(), 5000);
+}
+
+TEST(Parallel, EmptyWithZeroCutoff)
+{
+    svec::SThreadPool pool(3);
+    Cutoff cutoff(0);
+    svec::SVector<int64_t, 16> empty;
+    svec::SVector<int64_t, 16> out{1, 2, 3};
+    svec::parallel::sort(pool, empty);
+    svec::parallel::forEach(pool, empty, [](int64_t& value) { value++; });
+    EXPECT_EQ(svec::parallel::reduce(pool, empty, int64_t{7}), 7);
+    svec::parallel::transform(pool, empty, out, [](int64_t value) { return value; });
+    EXPECT_EQ(out.size(), 0);
+    out.pushBack(1);
+    svec::parallel::inclusiveScan(pool, empty, out);
+    EXPECT_EQ(out.size(), 0);
+
+    // a single element still takes the parallel paths
+    svec::SVector<int64_t, 16> one{5};
+    EXPECT_EQ(svec::parallel::reduce(pool, one, int64_t{7}), 12);
+    svec::parallel::inclusiveScan(pool, one, out);
+    EXPECT_TRUE(out == (svec::SVector<int64_t, 16>{5}));
+}
+
+TEST(Parallel, MappedStorageAndDefaultPool)
+{
+    svec::SMappedVector<int32_t, SIZE> mapped;
+    std::mt19937 random(9);
+    for (size_t i = 0; i < SIZE; i++)
+    {
+        mapped.pushBack(static_cast<int32_t>(random()));
+    }
+    svec::parallel::sort(mapped);
+    EXPECT_TRUE(std::is_sorted(mapped.begin(), mapped.end()));
+    int64_t total = svec::parallel::reduce(mapped, int64_t{0});
+    EXPECT_EQ(total, std::accumulate(mapped.begin(), mapped.end(), int64_t{0}));
+}
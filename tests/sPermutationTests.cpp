@@ -0,0 +1,162 @@
+// Copyright 2025 Dalton Prokosch
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gtest/gtest.h"
+#include "sPermutation.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <string>
+
+namespace
+{
+
+/**
+ * @brief Returns a shuffled permutation of size indices
+ */
+template<typename I, size_t N>
+svec::SVector<I, N> randomPermutation(size_t size, std::mt19937& rng)
+{
+    svec::SVector<I, N> permutation;
+    permutation.resizeForOverwrite(size);
+    std::iota(permutation.begin(), permutation.end(), I{0});
+    std::shuffle(permutation.begin(), permutation.end(), rng);
+    return permutation;
+}
+
+/**
+ * @brief Applies permutation through a copy, the result applyPermutation has to match
+ */
+template<typename T, size_t C, typename I, size_t N>
+svec::SVector<T, C> copyPermuted(const svec::SVector<T, C>& vec, const svec::SVector<I, N>& permutation)
+{
+    svec::SVector<T, C> result;
+    for (size_t i = 0; i < permutation.size(); i++)
+    {
+        result.pushBack(vec[permutation[i]]);
+    }
+    return result;
+}
+
+}
+
+TEST(Permutation, ApplyMatchesCopy)
+{
+    std::mt19937 rng(7);
+    for (size_t size : {0, 1, 2, 17, 300})
+    {
+        svec::SVector<uint32_t, 300> permutation = randomPermutation<uint32_t, 300>(size, rng);
+        svec::SVector<std::string, 300> vec;
+        for (size_t i = 0; i < size; i++)
+        {
+            vec.pushBack("element number " + std::to_string(i));
+        }
+        svec::SVector<std::string, 300> expected = copyPermuted(vec, permutation);
+        svec::applyPermutation(vec, permutation);
+        EXPECT_TRUE(vec == expected);
+    }
+}
+
+TEST(Permutation, IdentityAndSwap)
+{
+    svec::SVector<int, 8> vec{10, 11, 12, 13};
+    svec::applyPermutation(vec, svec::SVector<uint8_t, 8>{0, 1, 2, 3});
+    EXPECT_TRUE(vec == (svec::SVector<int, 8>{10, 11, 12, 13}));
+    svec::applyPermutation(vec, svec::SVector<uint8_t, 8>{1, 0, 3, 2});
+    EXPECT_TRUE(vec == (svec::SVector<int, 8>{11, 10, 13, 12}));
+    svec::applyPermutation(vec, svec::SVector<uint8_t, 8>{3, 0, 1, 2});
+    EXPECT_TRUE(vec == (svec::SVector<int, 8>{12, 11, 10, 13}));
+}
+
+TEST(Permutation, ParallelArraysAfterSort)
+{
+    std::mt19937 rng(11);
+    svec::SVector<int, 500> keys;
+    svec::SVector<double, 500> weights;
+    svec::SVector<std::string, 500> names;
+    for (int i = 0; i < 500; i++)
+    {
+        int key = static_cast<int>(rng() % 1000);
+        keys.pushBack(key);
+        weights.pushBack(key * 0.5);
+        names.pushBack(std::to_string(key));
+    }
+
+    svec::SVector<uint16_t, 500> order = randomPermutation<uint16_t, 500>(500, rng);
+    std::stable_sort(order.data(), order.data() + order.size(), [&](uint16_t a, uint16_t b) { return keys[a] < keys[b]; });
+    svec::permuteTogether(order, keys, weights, names);
+
+    EXPECT_TRUE(std::is_sorted(keys.begin(), keys.end()));
+    for (size_t i = 0; i < keys.size(); i++)
+    {
+        EXPECT_EQ(weights[i], keys[i] * 0.5);
+        EXPECT_EQ(names[i], std::to_string(keys[i]));
+    }
+}
+
+TEST(Permutation, GatherScatter)
+{
+    std::mt19937 rng(3);
+    svec::SVector<uint32_t, 1000> source32;
+    svec::SVector<uint64_t, 1000> source64;
+    svec::SVector<std::string, 1000> sourceStrings;
+    for (uint32_t i = 0; i < 1000; i++)
+    {
+        source32.pushBack(i * 3 + 1);
+        source64.pushBack((uint64_t{i} << 40) | i);
+        sourceStrings.pushBack(std::to_string(i));
+    }
+
+    svec::SVector<int32_t, 1000> indices;
+    for (size_t i = 0; i < 999; i++)
+    {
+        indices.pushBack(static_cast<int32_t>(rng() % 1000));
+    }
+    svec::SVector<uint32_t, 1000> gathered32;
+    svec::SVector<uint64_t, 1000> gathered64;
+    svec::SVector<std::string, 1000> gatheredStrings;
+    svec::gather(source32, indices, gathered32);
+    svec::gather(source64, indices, gathered64);
+    svec::gather(sourceStrings, indices, gatheredStrings);
+    ASSERT_EQ(gathered32.size(), indices.size());
+    ASSERT_EQ(gathered64.size(), indices.size());
+    for (size_t i = 0; i < indices.size(); i++)
+    {
+        EXPECT_EQ(gathered32[i], source32[indices[i]]);
+        EXPECT_EQ(gathered64[i], source64[indices[i]]);
+        EXPECT_EQ(gatheredStrings[i], sourceStrings[indices[i]]);
+    }
+
+    // scattering through a permutation undoes gathering through it
+    svec::SVector<int32_t, 1000> permutation = randomPermutation<int32_t, 1000>(1000, rng);
+    svec::gather(source32, permutation, gathered32);
+    svec::SVector<uint32_t, 1000> restored;
+    restored.resize(1000, 0);
+    svec::scatter(gathered32, permutation, restored);
+    EXPECT_TRUE(restored == source32);
+
+    // repeated indices keep the last write
+    svec::SVector<uint32_t, 32> values;
+    svec::SVector<uint32_t, 32> targets;
+    for (uint32_t i = 0; i < 32; i++)
+    {
+        values.pushBack(i);
+        targets.pushBack(i % 4);
+    }
+    svec::SVector<uint32_t, 32> out;
+    out.resize(4, 0);
+    svec::scatter(values, targets, out);
+    EXPECT_TRUE(out == (svec::SVector<uint32_t, 32>{28, 29, 30, 31}));
+}
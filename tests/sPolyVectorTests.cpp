@@ -0,0 +1,173 @@
+// Copyright 2025 Dalton Prokosch
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gtest/gtest.h"
+#include "sPolyVector.hpp"
+
+#include <string>
+
+struct Handler
+{
+    virtual ~Handler() = default;
+    virtual int handle(int value) const = 0;
+
+    static inline int alive = 0;
+};
+
+struct AddHandler : Handler
+{
+    AddHandler(int amount) : amount(amount) { alive++; }
+    AddHandler(AddHandler&& other) : amount(other.amount) { alive++; }
+    ~AddHandler() { alive--; }
+    int handle(int value) const override { return value + amount; }
+
+    int amount;
+};
+
+struct alignas(32) ScaleHandler : Handler
+{
+    ScaleHandler(int factor) : factor(factor) { alive++; }
+    ScaleHandler(ScaleHandler&& other) : factor(other.factor), name(std::move(other.name)) { alive++; }
+    ~ScaleHandler() { alive--; }
+    int handle(int value) const override { return value * factor; }
+
+    int factor;
+    std::string name = "a name long enough to live on the heap";
+};
+
+struct Named
+{
+    virtual ~Named() = default;
+    char tag[24] = {};
+};
+
+struct NegateHandler : Named, Handler
+{
+    NegateHandler() { alive++; }
+    NegateHandler(NegateHandler&&) { alive++; }
+    ~NegateHandler() { alive--; }
+    int handle(int value) const override { return -value; }
+};
+
+TEST(SPolyVector, EmplaceAndDispatch)
+{
+    svec::SPolyVector<Handler, 512> handlers;
+    handlers.emplaceBack<AddHandler>(3);
+    ScaleHandler& scale = handlers.emplaceBack<ScaleHandler>(2);
+    handlers.emplaceBack<NegateHandler>();
+    EXPECT_EQ(handlers.size(), 3);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(&scale) % 32, 0) << "Elements should keep their alignment";
+
+    int value = 1;
+    for (const Handler& handler : handlers)
+    {
+        value = handler.handle(value);
+    }
+    EXPECT_EQ(value, -8);
+    EXPECT_EQ(handlers[2].handle(5), -5) << "Base that is not the first base class should be adjusted";
+}
+
+TEST(SPolyVector, FullBuffer)
+{
+    svec::SPolyVector<Handler, 64> handlers;
+    size_t added = 0;
+    while (handlers.tryEmplaceBack<AddHandler>(1))
+    {
+        added++;
+    }
+    EXPECT_GT(added, 0);
+    EXPECT_LE(handlers.bytesUsed(), handlers.capacity());
+    EXPECT_EQ(handlers.tryEmplaceBack<ScaleHandler>(2), nullptr);
+    EXPECT_EQ(handlers.size(), added);
+}
+
+TEST(SPolyVector, EraseRelocatesAndDestroys)
+{
+    Handler::alive = 0;
+    {
+        svec::SPolyVector<Handler, 1024> handlers;
+        handlers.emplaceBack<AddHandler>(1);
+        handlers.emplaceBack<ScaleHandler>(3);
+        handlers.emplaceBack<NegateHandler>();
+        handlers.emplaceBack<AddHandler>(10);
+        handlers.emplaceBack<ScaleHandler>(5);
+        EXPECT_EQ(Handler::alive, 5);
+
+        size_t used = handlers.bytesUsed();
+        handlers.erase(1);
+        EXPECT_EQ(Handler::alive, 4);
+        EXPECT_LT(handlers.bytesUsed(), used);
+        ASSERT_EQ(handlers.size(), 4);
+        EXPECT_EQ(handlers[0].handle(1), 2);
+        EXPECT_EQ(handlers[1].handle(1), -1);
+        EXPECT_EQ(handlers[2].handle(1), 11);
+        EXPECT_EQ(handlers[3].handle(1), 5);
+        EXPECT_EQ(static_cast<const ScaleHandler&>(handlers[3]).name, "a name long enough to live on the heap");
+
+        handlers.popBack();
+        EXPECT_EQ(Handler::alive, 3);
+    }
+    EXPECT_EQ(Handler::alive, 0) << "Destructor should destroy every element";
+}
+
+TEST(SPolyVector, MoveRelocates)
+{
+    Handler::alive = 0;
+    {
+        svec::SPolyVector<Handler, 512> handlers;
+        handlers.emplaceBack<ScaleHandler>(4);
+        handlers.emplaceBack<NegateHandler>();
+
+        svec::SPolyVector<Handler, 512> moved(std::move(handlers));
+        EXPECT_EQ(handlers.size(), 0);
+        EXPECT_EQ(handlers.bytesUsed(), 0);
+        ASSERT_EQ(moved.size(), 2);
+        EXPECT_EQ(moved[0].handle(2), 8);
+        EXPECT_EQ(moved[1].handle(2), -2);
+        EXPECT_EQ(Handler::alive, 2);
+
+        handlers.emplaceBack<AddHandler>(1);
+        handlers = std::move(moved);
+        EXPECT_EQ(handlers.size(), 2);
+        EXPECT_EQ(Handler::alive, 2);
+    }
+    EXPECT_EQ(Handler::alive, 0);
+}
+
+struct BigHandler : Handler
+{
+    BigHandler(int value) { alive++; values[0] = value; values[63] = value; }
+    BigHandler(BigHandler&& other) { alive++; std::copy(other.values, other.values + 64, values); }
+    ~BigHandler() { alive--; }
+    int handle(int) const override { return values[0] + values[63]; }
+
+    int values[64] = {};
+};
+
+TEST(SPolyVector, EraseIntoOverlappingSlot)
+{
+    Handler::alive = 0;
+    {
+        svec::SPolyVector<Handler, 1024> handlers;
+        handlers.emplaceBack<AddHandler>(1);
+        const Handler* before = &handlers.emplaceBack<BigHandler>(7);
+        handlers.erase(0);
+        const Handler* after = &handlers[0];
+        ASSERT_LT(reinterpret_cast<const std::byte*>(before) - reinterpret_cast<const std::byte*>(after), sizeof(BigHandler))
+            << "Element should have moved by less than its size";
+        EXPECT_EQ(handlers[0].handle(0), 14);
+        EXPECT_EQ(Handler::alive, 1);
+    }
+    EXPECT_EQ(Handler::alive, 0);
+}
@@ -0,0 +1,119 @@
+// Copyright 2025 Dalton Prokosch
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gtest/gtest.h"
+#include "sRadixSort.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+/**
+ * @brief Radix sorts count random values and checks the result against std::stable_sort on the mapped keys
+ */
+template<typename T, size_t CAPACITY, typename GENERATOR>
+void expectSorted(size_t count, GENERATOR&& generate)
+{
+    std::mt19937_64 random(count);
+    std::unique_ptr<svec::SVector<T, CAPACITY>> vec = std::make_unique<svec::SVector<T, CAPACITY>>();
+    for (size_t i = 0; i < count; i++)
+    {
+        vec->pushBack(generate(random));
+    }
+    std::vector<T> expected(vec->data(), vec->data() + vec->size());
+    std::stable_sort(expected.begin(), expected.end(), [](T a, T b) { return svec::radix::toUnsigned(a) < svec::radix::toUnsigned(b); });
+
+    svec::radixSort(*vec);
+    ASSERT_EQ(vec->size(), count);
+    EXPECT_TRUE(std::equal(expected.begin(), expected.end(), vec->data(), [](T a, T b) { return svec::radix::toUnsigned(a) == svec::radix::toUnsigned(b); }));
+}
+
+struct Payload
+{
+    uint16_t key;
+    std::string name;
+};
+
+}
+
+TEST(RadixSort, Integers)
+{
+    for (size_t count : {0, 1, 5, 63, 64, 65, 200, 5000})
+    {
+        expectSorted<uint32_t, 5000>(count, [](std::mt19937_64& random) { return static_cast<uint32_t>(random()); });
+        expectSorted<int32_t, 5000>(count, [](std::mt19937_64& random) { return static_cast<int32_t>(random()); });
+        expectSorted<int64_t, 5000>(count, [](std::mt19937_64& random) { return static_cast<int64_t>(random()); });
+        expectSorted<int8_t, 5000>(count, [](std::mt19937_64& random) { return static_cast<int8_t>(random()); });
+        expectSorted<uint16_t, 5000>(count, [](std::mt19937_64& random) { return static_cast<uint16_t>(random()); });
+    }
+    // 11 bit digits and constant high digits being skipped
+    expectSorted<uint32_t, 70000>(70000, [](std::mt19937_64& random) { return static_cast<uint32_t>(random()); });
+    expectSorted<uint64_t, 70000>(70000, [](std::mt19937_64& random) { return random() % 1000; });
+    expectSorted<int32_t, 70000>(70000, [](std::mt19937_64&) { return -7; });
+}
+
+TEST(RadixSort, FloatingPoint)
+{
+    for (size_t count : {10, 300, 5000})
+    {
+        expectSorted<float, 5000>(count, [](std::mt19937_64& random) { return std::normal_distribution<float>(0.0f, 100.0f)(random); });
+        expectSorted<double, 5000>(count, [](std::mt19937_64& random) { return std::normal_distribution<double>(0.0, 1e300)(random); });
+    }
+
+    svec::SVector<double, 200> vec;
+    for (size_t i = 0; i < 20; i++)
+    {
+        for (double value : {3.5, -0.0, 0.0, -std::numeric_limits<double>::infinity(), std::numeric_limits<double>::infinity(),
+                             -1e-300, 1e-300, -2.0, std::numeric_limits<double>::denorm_min()})
+        {
+            vec.pushBack(value);
+        }
+    }
+    svec::radixSort(vec);
+    EXPECT_TRUE(std::is_sorted(vec.begin(), vec.end()));
+    EXPECT_EQ(vec[0], -std::numeric_limits<double>::infinity());
+    EXPECT_TRUE(std::signbit(vec[79]));
+    EXPECT_FALSE(std::signbit(vec[80]));
+    EXPECT_EQ(vec[179], std::numeric_limits<double>::infinity());
+}
+
+TEST(RadixSort, StableByKey)
+{
+    for (size_t count : {30, 3000})
+    {
+        std::mt19937 random(count);
+        svec::SVector<Payload, 3000> vec;
+        for (size_t i = 0; i < count; i++)
+        {
+            vec.pushBack(Payload{static_cast<uint16_t>(random() % 50), std::to_string(i) + " with a payload too long for small strings"});
+        }
+        std::vector<Payload> expected(vec.data(), vec.data() + vec.size());
+        std::stable_sort(expected.begin(), expected.end(), [](const Payload& a, const Payload& b) { return a.key < b.key; });
+
+        svec::radixSort(vec, [](const Payload& payload) { return payload.key; });
+        ASSERT_EQ(vec.size(), count);
+        for (size_t i = 0; i < count; i++)
+        {
+            EXPECT_EQ(vec[i].key, expected[i].key);
+            EXPECT_EQ(vec[i].name, expected[i].name);
+        }
+    }
+}
@@ -0,0 +1,149 @@
+// Copyright 2025 Dalton Prokosch
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gtest/gtest.h"
+#include "sRecordBuffer.hpp"
+
+#include <algorithm>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+
+std::span<const std::byte> asBytes(std::string_view text)
+{
+    return std::as_bytes(std::span<const char>(text.data(), text.size()));
+}
+
+std::string asString(std::span<const std::byte> bytes)
+{
+    return std::string(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+}
+
+template<typename BUFFER>
+std::vector<std::string> records(const BUFFER& buffer)
+{
+    std::vector<std::string> result;
+    for (std::span<const std::byte> record : buffer)
+    {
+        result.push_back(asString(record));
+    }
+    return result;
+}
+
+struct Quote
+{
+    double price;
+    uint64_t quantity;
+};
+
+}
+
+TEST(SRecordBuffer, AppendAndIterate)
+{
+    svec::SRecordBuffer<256> buffer;
+    EXPECT_TRUE(buffer.empty());
+    EXPECT_TRUE(buffer.append(asBytes("hello")));
+    EXPECT_TRUE(buffer.append(asBytes("")));
+    EXPECT_TRUE(buffer.append(asBytes("a longer record")));
+    EXPECT_EQ(records(buffer), (std::vector<std::string>{"hello", "", "a longer record"}));
+    EXPECT_EQ(buffer.size(), buffer.recordBytes(5) + buffer.recordBytes(0) + buffer.recordBytes(15));
+    EXPECT_EQ(buffer.recordBytes(5), 16);
+
+    for (std::span<const std::byte> record : buffer)
+    {
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(record.data()) % 8, 0);
+    }
+    // padding is zeroed
+    std::span<const std::byte> bytes = buffer.bytes();
+    EXPECT_TRUE(std::all_of(bytes.begin() + 8 + 5, bytes.begin() + 16, [](std::byte b) { return b == std::byte{0}; }));
+}
+
+TEST(SRecordBuffer, PrepareCommitAndFull)
+{
+    svec::SRecordBuffer<64, 16> buffer;
+    std::span<std::byte> space = buffer.prepare(sizeof(Quote) * 2);
+    ASSERT_EQ(space.size(), sizeof(Quote) * 2);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(space.data()) % 16, 0);
+    new (space.data()) Quote{101.5, 300};
+    buffer.commit(sizeof(Quote));
+
+    ASSERT_FALSE(buffer.empty());
+    const Quote* quote = reinterpret_cast<const Quote*>(buffer.front().data());
+    EXPECT_EQ(buffer.front().size(), sizeof(Quote));
+    EXPECT_EQ(quote->price, 101.5);
+    EXPECT_EQ(quote->quantity, 300);
+
+    EXPECT_EQ(buffer.prepare(33).data(), nullptr);
+    EXPECT_TRUE(buffer.append(asBytes("fits in 32 bytes")));
+    EXPECT_EQ(buffer.size(), 64);
+    EXPECT_FALSE(buffer.append(asBytes("")));
+    EXPECT_EQ(std::distance(buffer.begin(), buffer.end()), 2);
+}
+
+TEST(SRecordBuffer, PopFrontAndCompact)
+{
+    svec::SRecordBuffer<128> buffer;
+    for (std::string_view text : {"one", "two", "three", "four"})
+    {
+        EXPECT_TRUE(buffer.append(asBytes(text)));
+    }
+    EXPECT_FALSE(buffer.append(asBytes(std::string(60, 'x'))));
+
+    EXPECT_EQ(asString(buffer.front()), "one");
+    buffer.popFront();
+    buffer.popFront();
+    EXPECT_EQ(records(buffer), (std::vector<std::string>{"three", "four"}));
+    EXPECT_EQ(buffer.size(), 32);
+
+    buffer.compact();
+    EXPECT_EQ(records(buffer), (std::vector<std::string>{"three", "four"}));
+    EXPECT_TRUE(buffer.append(asBytes(std::string(60, 'x'))));
+    buffer.popFront();
+    buffer.popFront();
+    buffer.popFront();
+    EXPECT_TRUE(buffer.empty());
+    buffer.compact();
+    EXPECT_EQ(buffer.size(), 0);
+}
+
+TEST(SRecordBuffer, ReceiveSplitBytes)
+{
+    svec::SRecordBuffer<1024> sent;
+    std::vector<std::string> expected;
+    for (size_t i = 0; i < 20; i++)
+    {
+        expected.push_back(std::string(i * 3, static_cast<char>('a' + i)));
+        ASSERT_TRUE(sent.append(asBytes(expected.back())));
+    }
+
+    // bytes arrive in pieces that split headers and payloads, complete records are read and dropped as they come in
+    svec::SRecordBuffer<128> received;
+    std::vector<std::string> read;
+    std::span<const std::byte> wire = sent.bytes();
+    for (size_t offset = 0; offset < wire.size(); offset += 13)
+    {
+        ASSERT_TRUE(received.appendBytes(wire.subspan(offset, std::min<size_t>(13, wire.size() - offset))));
+        while (!received.empty())
+        {
+            read.push_back(asString(received.front()));
+            received.popFront();
+        }
+        received.compact();
+    }
+    EXPECT_EQ(read, expected);
+    EXPECT_EQ(received.size(), 0);
+}
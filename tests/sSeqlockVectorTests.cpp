@@ -0,0 +1,149 @@
+// Copyright 2025 Dalton Prokosch
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gtest/gtest.h"
+#include "sSeqlockVector.hpp"
+
+#include <thread>
+#include <vector>
+
+struct Route
+{
+    uint32_t destination;
+    uint16_t port;
+    uint8_t weight;
+
+    bool operator==(const Route& other) const
+    {
+        return destination == other.destination && port == other.port && weight == other.weight;
+    }
+};
+
+TEST(SSeqlockVector, StoreAndLoad)
+{
+    svec::SSeqlockVector<Route, 64> table;
+    EXPECT_EQ(table.load().size(), 0);
+
+    svec::SVector<Route, 64> routes({{1, 80, 1}, {2, 443, 2}, {3, 8080, 3}});
+    table.store(routes);
+    EXPECT_EQ(table.load(), routes);
+    EXPECT_EQ(table.version(), 1);
+}
+
+#ifdef _DEBUG
+TEST(SSeqlockVector, StoreLargerThanCapacityThrows)
+{
+    svec::SSeqlockVector<int, 4> table;
+    std::vector<int> elements = {1, 2, 3, 4, 5};
+    EXPECT_THROW(table.store(std::span<const int>(elements)), std::out_of_range);
+    EXPECT_EQ(table.version(), 0) << "failed store should not begin a write";
+}
+
+TEST(SSeqlockVector, PushBackOntoFullThrows)
+{
+    svec::SSeqlockVector<int, 2> table;
+    table.pushBack(1);
+    table.pushBack(2);
+    EXPECT_THROW(table.pushBack(3), std::out_of_range);
+    EXPECT_EQ(table.load().size(), 2);
+    EXPECT_EQ(table.version(), 2);
+}
+
+TEST(SSeqlockVector, SetPastSizeThrows)
+{
+    svec::SSeqlockVector<int, 4> table;
+    table.pushBack(1);
+    EXPECT_THROW(table.set(1, 2), std::out_of_range);
+    EXPECT_THROW(table.set(4, 2), std::out_of_range);
+    EXPECT_EQ(table.load()[0], 1);
+}
+
+TEST(SSeqlockVector, PopBackOnEmptyThrows)
+{
+    svec::SSeqlockVector<int, 4> table;
+    EXPECT_THROW(table.popBack(), std::out_of_range);
+    EXPECT_EQ(table.load().size(), 0);
+    EXPECT_EQ(table.version(), 0);
+}
+#endif // _DEBUG end
+
+TEST(SSeqlockVector, InPlaceUpdates)
+{
+    svec::SSeqlockVector<Route, 64> table;
+    table.pushBack({1, 80, 1});
+    table.pushBack({2, 443, 2});
+    table.pushBack({3, 22, 3});
+    table.set(1, {5, 5, 5});
+
+    svec::SVector<Route, 64> expectedA({{1, 80, 1}, {5, 5, 5}, {3, 22, 3}});
+    EXPECT_EQ(table.load(), expectedA) << "Unaligned element writes should not disturb neighbours";
+
+    table.popBack();
+    svec::SVector<Route, 64> expectedB({{1, 80, 1}, {5, 5, 5}});
+    svec::SVector<Route, 64> snapshot;
+    table.load(snapshot);
+    EXPECT_EQ(snapshot, expectedB);
+
+    table.clear();
+    table.load(snapshot);
+    EXPECT_EQ(snapshot.size(), 0);
+}
+
+struct Uniform
+{
+    uint64_t a, b, c;
+};
+
+TEST(SSeqlockVector, ReadersNeverSeeTornSnapshots)
+{
+    svec::SSeqlockVector<Uniform, 16> table;
+    std::atomic<bool> done{false};
+
+    std::vector<std::thread> readers;
+    for (int r = 0; r < 3; r++)
+    {
+        readers.emplace_back([&]()
+        {
+            svec::SVector<Uniform, 16> snapshot;
+            while (!done.load(std::memory_order_relaxed))
+            {
+                table.load(snapshot);
+                for (const Uniform& element : snapshot)
+                {
+                    ASSERT_EQ(element.a, element.b) << "Torn element";
+                    ASSERT_EQ(element.b, element.c) << "Torn element";
+                    ASSERT_EQ(element.a, snapshot.size()) << "Elements from different writes mixed";
+                }
+            }
+        });
+    }
+
+    svec::SVector<Uniform, 16> write;
+    for (uint64_t i = 0; i < 20000; i++)
+    {
+        size_t size = i % 16 + 1;
+        write.resizeForOverwrite(size);
+        for (Uniform& element : write)
+        {
+            element = {size, size, size};
+        }
+        table.store(write);
+    }
+    done.store(true);
+    for (std::thread& reader : readers)
+    {
+        reader.join();
+    }
+    EXPECT_EQ(table.version(), 20000);
+}
@@ -0,0 +1,179 @@
+// Copyright 2025 Dalton Prokosch
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gtest/gtest.h"
+#include "sSetOperations.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <random>
+#include <set>
+#include <vector>
+
+namespace
+{
+
+/**
+ * @brief Draws size distinct sorted values below range
+ */
+template<typename T, size_t CAPACITY>
+svec::SVector<T, CAPACITY> makeSet(std::mt19937_64& random, size_t size, uint64_t range, T offset = 0)
+{
+    std::set<T> values;
+    while (values.size() < size)
+    {
+        values.insert(static_cast<T>(random() % range) + offset);
+    }
+    svec::SVector<T, CAPACITY> set;
+    for (T value : values)
+    {
+        set.pushBack(value);
+    }
+    return set;
+}
+
+template<typename T, size_t CAPACITY>
+std::vector<T> toVector(const svec::SVector<T, CAPACITY>& set)
+{
+    return std::vector<T>(set.data(), set.data() + set.size());
+}
+
+/**
+ * @brief Checks every operation against the std algorithms for many sizes and overlaps
+ */
+template<typename T>
+void matchesStd(T offset)
+{
+    constexpr size_t CAPACITY = 4'096;
+    std::mt19937_64 random(sizeof(T));
+    const size_t sizes[] = {0, 1, 3, 4, 7, 33, 100, 1'000, 2'048};
+    for (size_t aSize : sizes)
+    {
+        for (size_t bSize : sizes)
+        {
+            for (uint64_t range : {aSize + bSize + 1, 4 * (aSize + bSize) + 1, uint64_t{1} << 20})
+            {
+                auto a = makeSet<T, CAPACITY / 2>(random, aSize, range, offset);
+                auto b = makeSet<T, CAPACITY / 2>(random, bSize, range, offset);
+                std::vector<T> expected;
+
+                svec::SVector<T, CAPACITY> out;
+                svec::intersect(a, b, out);
+                std::set_intersection(a.data(), a.data() + a.size(), b.data(), b.data() + b.size(), std::back_inserter(expected));
+                ASSERT_EQ(toVector(out), expected) << "intersect " << aSize << " " << bSize << " " << range;
+                EXPECT_EQ(svec::intersectCount(a, b), expected.size());
+
+                expected.clear();
+                svec::unite(a, b, out);
+                std::set_union(a.data(), a.data() + a.size(), b.data(), b.data() + b.size(), std::back_inserter(expected));
+                ASSERT_EQ(toVector(out), expected) << "unite " << aSize << " " << bSize << " " << range;
+
+                expected.clear();
+                svec::difference(a, b, out);
+                std::set_difference(a.data(), a.data() + a.size(), b.data(), b.data() + b.size(), std::back_inserter(expected));
+                ASSERT_EQ(toVector(out), expected) << "difference " << aSize << " " << bSize << " " << range;
+            }
+        }
+    }
+}
+
+}
+
+TEST(SetOperations, Small)
+{
+    svec::SVector<uint32_t, 8> a = {1, 3, 5, 7, 9};
+    svec::SVector<uint32_t, 8> b = {2, 3, 4, 5, 6, 10};
+    svec::SVector<uint32_t, 16> out;
+
+    svec::intersect(a, b, out);
+    EXPECT_EQ(out, (svec::SVector<uint32_t, 16>{3, 5}));
+    EXPECT_EQ(svec::intersectCount(a, b), 2);
+    svec::unite(a, b, out);
+    EXPECT_EQ(out, (svec::SVector<uint32_t, 16>{1, 2, 3, 4, 5, 6, 7, 9, 10}));
+    svec::difference(a, b, out);
+    EXPECT_EQ(out, (svec::SVector<uint32_t, 16>{1, 7, 9}));
+    svec::difference(b, a, out);
+    EXPECT_EQ(out, (svec::SVector<uint32_t, 16>{2, 4, 6, 10}));
+}
+
+TEST(SetOperations, MatchesStdUnsigned)
+{
+    matchesStd<uint32_t>(0);
+    matchesStd<uint32_t>(0x7FFF'0000);
+}
+
+TEST(SetOperations, MatchesStdSigned)
+{
+    matchesStd<int32_t>(-(1 << 19));
+}
+
+TEST(SetOperations, MatchesStdWide)
+{
+    matchesStd<uint64_t>(1ull << 40);
+    matchesStd<int16_t>(-100);
+}
+
+TEST(SetOperations, Galloping)
+{
+    std::mt19937_64 random(3);
+    auto large = makeSet<uint32_t, 100'000>(random, 100'000, 1'000'000);
+    svec::SVector<uint32_t, 16> small = {large[5], 17, large[50'000], large[99'999]};
+    std::sort(small.begin(), small.end());
+    svec::SVector<uint32_t, 100'016> out;
+
+    svec::intersect(small, large, out);
+    std::vector<uint32_t> expected;
+    std::set_intersection(small.begin(), small.end(), large.begin(), large.end(), std::back_inserter(expected));
+    EXPECT_EQ(toVector(out), expected);
+    EXPECT_EQ(svec::intersectCount(large, small), expected.size());
+
+    svec::unite(large, small, out);
+    expected.clear();
+    std::set_union(small.begin(), small.end(), large.begin(), large.end(), std::back_inserter(expected));
+    EXPECT_EQ(toVector(out), expected);
+
+    svec::difference(small, large, out);
+    expected.clear();
+    std::set_difference(small.begin(), small.end(), large.begin(), large.end(), std::back_inserter(expected));
+    EXPECT_EQ(toVector(out), expected);
+}
+
+TEST(SetOperations, CapacityCheckedUpFront)
+{
+    svec::SVector<uint32_t, 8> a = {1, 2, 3, 4, 5};
+    svec::SVector<uint32_t, 8> b = {1, 2, 3, 4, 5};
+    svec::SVector<uint32_t, 6> out = {42};
+
+    EXPECT_THROW(svec::unite(a, b, out), std::length_error) << "worst case of 10 does not fit in 6";
+    EXPECT_EQ(out.size(), 1) << "out should be untouched when the check fails";
+    EXPECT_NO_THROW(svec::intersect(a, b, out));
+    EXPECT_EQ(out.size(), 5);
+}
+
+#ifdef _DEBUG
+TEST(SetOperations, AliasedOutputThrows)
+{
+    svec::SVector<uint32_t, 16> a = {1, 3, 5, 7};
+    svec::SVector<uint32_t, 16> b = {3, 4, 5};
+
+    EXPECT_THROW(svec::intersect(a, b, a), std::invalid_argument);
+    EXPECT_THROW(svec::intersect(a, b, b), std::invalid_argument);
+    EXPECT_THROW(svec::unite(a, b, a), std::invalid_argument);
+    EXPECT_THROW(svec::unite(a, b, b), std::invalid_argument);
+    EXPECT_THROW(svec::difference(a, b, a), std::invalid_argument);
+    EXPECT_THROW(svec::difference(a, b, b), std::invalid_argument);
+    EXPECT_EQ(a.size(), 4) << "inputs should be untouched when the check fails";
+    EXPECT_EQ(b.size(), 3);
+}
+#endif // _DEBUG end
@@ -0,0 +1,159 @@
+// Copyright 2025 Dalton Prokosch
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gtest/gtest.h"
+#include "sString.hpp"
+
+#include <sstream>
+
+TEST(SStringConstructor, DefaultConstructor)
+{
+    svec::SString<15> SString;
+    EXPECT_EQ(SString.size(), 0);
+    EXPECT_TRUE(SString.empty());
+    EXPECT_STREQ(SString.c_str(), "");
+}
+
+TEST(SStringConstructor, CompactSize)
+{
+    EXPECT_EQ(sizeof(svec::SString<15>), 17) << "SString<15> should only need one byte for size";
+    EXPECT_EQ(sizeof(svec::SString<15>::SizeType), 1);
+    EXPECT_EQ(sizeof(svec::SString<300>::SizeType), 2);
+    EXPECT_EQ(sizeof(svec::SString<70000>::SizeType), 4);
+}
+
+TEST(SStringConstructor, FromStringAndSVector)
+{
+    svec::SString<31> SStringA("symbol");
+    EXPECT_EQ(SStringA.size(), 6);
+    EXPECT_STREQ(SStringA.c_str(), "symbol");
+
+    svec::SVector<char, 8> SVector({'k', 'e', 'y'});
+    svec::SString<8> SStringB(SVector);
+    EXPECT_EQ(SStringB, "key");
+}
+
+TEST(SStringSet, AppendKeepsNullTerminator)
+{
+    svec::SString<31> SString;
+    SString.append("log");
+    SString += '.';
+    SString += "tag";
+    EXPECT_EQ(SString.size(), 7);
+    EXPECT_STREQ(SString.c_str(), "log.tag");
+
+    SString.popBack();
+    EXPECT_STREQ(SString.c_str(), "log.ta");
+
+    SString.clear();
+    EXPECT_STREQ(SString.c_str(), "");
+}
+
+TEST(SStringSet, AppendFormat)
+{
+    svec::SString<31> SString("id=");
+    EXPECT_TRUE(SString.appendFormat("%d/%s", 42, "x"));
+    EXPECT_EQ(SString, "id=42/x");
+
+    svec::SString<8> small("ab");
+    EXPECT_FALSE(small.appendFormat("%s", "cdefghijk")) << "Output larger than capacity should report truncation";
+    EXPECT_EQ(small, "abcdefgh");
+    EXPECT_EQ(small.size(), 8);
+}
+
+TEST(SStringGet, StringViewConversion)
+{
+    svec::SString<15> SString("header");
+    std::string_view view = SString;
+    EXPECT_EQ(view, "header");
+    EXPECT_EQ(SString.str(), std::string("header"));
+
+    std::stringstream stream;
+    stream << SString;
+    EXPECT_EQ(stream.str(), "header");
+}
+
+TEST(SStringGet, FrontAndBack)
+{
+    svec::SString<15> SString("header");
+    SString.front() = 'H';
+    const svec::SString<15>& constString = SString;
+    EXPECT_EQ(constString.front(), 'H');
+    EXPECT_EQ(constString.back(), 'r');
+}
+
+TEST(SStringSearch, FindChar)
+{
+    svec::SString<63> SString("abcdefghijklmnopqrstuvwxyz0123456789");
+    EXPECT_EQ(SString.find('a'), 0);
+    EXPECT_EQ(SString.find('q'), 16);
+    EXPECT_EQ(SString.find('9'), 35) << "Tail after last full block not searched";
+    EXPECT_EQ(SString.find('!'), svec::SString<63>::npos);
+    EXPECT_EQ(SString.find('c', 3), svec::SString<63>::npos);
+}
+
+TEST(SStringSearch, FindString)
+{
+    svec::SString<127> SString("content-type: text/plain; content-length: 12; content-encoding: gzip");
+    EXPECT_EQ(SString.find("content"), 0);
+    EXPECT_EQ(SString.find("content", 1), 26);
+    EXPECT_EQ(SString.find("content-encoding"), 46);
+    EXPECT_EQ(SString.find("gzip"), 64);
+    EXPECT_EQ(SString.find("gzipp"), svec::SString<127>::npos);
+    EXPECT_EQ(SString.find(""), 0);
+    EXPECT_EQ(SString.find("c"), 0);
+
+    for (size_t i = 0; i < SString.size(); i++)
+    {
+        for (size_t length = 1; length < 6 && i + length <= SString.size(); length++)
+        {
+            std::string_view needle = std::string_view(SString).substr(i, length);
+            EXPECT_EQ(SString.find(needle), std::string_view(SString).find(needle)) << needle;
+        }
+    }
+}
+
+TEST(SStringSearch, FindFirstOf)
+{
+    svec::SString<63> SString("key_with_no_separators_until_here:value");
+    EXPECT_EQ(SString.findFirstOf(":="), 33);
+    EXPECT_EQ(SString.findFirstOf("=;"), svec::SString<63>::npos);
+    EXPECT_EQ(SString.findFirstOf("ABCDEFGHIJKLMNOPQRSTUVWXYZ:"), 33) << "Lookup table path failed";
+    EXPECT_EQ(SString.findFirstOf("e", 2), 13);
+}
+
+TEST(SStringCompare, Compare)
+{
+    svec::SString<31> SString("abc");
+    EXPECT_EQ(SString.compare("abc"), 0);
+    EXPECT_LT(SString.compare("abd"), 0);
+    EXPECT_GT(SString.compare("ab"), 0);
+    EXPECT_LT(SString.compare("abcd"), 0);
+    EXPECT_TRUE(SString < std::string_view("b"));
+    EXPECT_TRUE(SString == svec::SString<31>("abc"));
+    EXPECT_FALSE(SString == "abcd");
+}
+
+TEST(SStringCompare, EqualsIgnoreCase)
+{
+    svec::SString<63> SString("Content-Length-Is-Longer-Than-Sixteen");
+    EXPECT_TRUE(SString.equalsIgnoreCase("content-length-is-longer-than-sixteen"));
+    EXPECT_TRUE(SString.equalsIgnoreCase("CONTENT-LENGTH-IS-LONGER-THAN-SIXTEEN"));
+    EXPECT_FALSE(SString.equalsIgnoreCase("content-length-is-longer-than-sixteem"));
+    EXPECT_FALSE(SString.equalsIgnoreCase("content-length"));
+
+    svec::SString<15> symbols("[@`{");
+    EXPECT_FALSE(symbols.equalsIgnoreCase("{`@[")) << "Only letters should be case folded";
+    EXPECT_TRUE(symbols.equalsIgnoreCase("[@`{"));
+}
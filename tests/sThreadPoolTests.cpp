@@ -0,0 +1,89 @@
+// Copyright 2025 Dalton Prokosch
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gtest/gtest.h"
+#include "sThreadPool.hpp"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+uint64_t fibonacci(svec::SThreadPool& pool, uint32_t n)
+{
+    if (n < 2)
+    {
+        return n;
+    }
+    if (n < 12)
+    {
+        return fibonacci(pool, n - 1) + fibonacci(pool, n - 2);
+    }
+    uint64_t a = 0;
+    uint64_t b = 0;
+    pool.join([&]() { a = fibonacci(pool, n - 1); }, [&]() { b = fibonacci(pool, n - 2); });
+    return a + b;
+}
+
+TEST(SThreadPool, RecursiveJoin)
+{
+    svec::SThreadPool pool(3);
+    EXPECT_EQ(pool.workers(), 3);
+    EXPECT_EQ(fibonacci(pool, 27), 196418);
+}
+
+TEST(SThreadPool, NoWorkersRunsOnCaller)
+{
+    svec::SThreadPool pool(0);
+    EXPECT_EQ(fibonacci(pool, 20), 6765);
+}
+
+TEST(SThreadPool, ParallelForCoversRangeOnce)
+{
+    svec::SThreadPool pool(3);
+    std::vector<std::atomic<int>> visits(100003);
+    pool.parallelFor(0, visits.size(), 1000, [&](size_t first, size_t last)
+    {
+        EXPECT_LE(last - first, 1000);
+        for (size_t i = first; i < last; i++)
+        {
+            visits[i]++;
+        }
+    });
+    for (size_t i = 0; i < visits.size(); i++)
+    {
+        ASSERT_EQ(visits[i].load(), 1) << "Index " << i;
+    }
+}
+
+TEST(SThreadPool, ManyOutsideThreads)
+{
+    svec::SThreadPool pool(2);
+    std::vector<std::thread> callers;
+    std::atomic<uint64_t> total{0};
+    for (int c = 0; c < 4; c++)
+    {
+        callers.emplace_back([&]()
+        {
+            for (int round = 0; round < 5; round++)
+            {
+                total += fibonacci(pool, 20);
+            }
+        });
+    }
+    for (std::thread& caller : callers)
+    {
+        caller.join();
+    }
+    EXPECT_EQ(total.load(), 4 * 5 * 6765);
+}
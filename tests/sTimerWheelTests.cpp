@@ -0,0 +1,167 @@
+// Copyright 2025 Dalton Prokosch
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gtest/gtest.h"
+#include "sTimerWheel.hpp"
+
+#include <algorithm>
+#include <map>
+#include <random>
+#include <vector>
+
+/**
+ * @brief Virtual clock driving a wheel, records the tick every payload fired at
+ */
+template<typename WHEEL>
+struct VirtualClock
+{
+    WHEEL wheel;
+    std::map<int, uint64_t> firedAt;
+
+    void advance(uint64_t ticks)
+    {
+        for (uint64_t i = 0; i < ticks; i++)
+        {
+            for (int payload : wheel.tick())
+            {
+                EXPECT_TRUE(firedAt.emplace(payload, wheel.now()).second) << "Payload " << payload << " fired twice";
+            }
+        }
+    }
+};
+
+TEST(STimerWheel, FiresOnDeadline)
+{
+    VirtualClock<svec::STimerWheel<int, 8, 3, 16>> clock;
+    clock.wheel.schedule(1, 1);
+    clock.wheel.schedule(5, 5);
+    clock.wheel.schedule(8, 8);
+    clock.wheel.schedule(63, 63);
+    clock.wheel.schedule(200, 200);
+    clock.wheel.schedule(0, 0);
+    EXPECT_EQ(clock.wheel.size(), 6);
+
+    clock.advance(300);
+    EXPECT_EQ(clock.firedAt[0], 1) << "Delay 0 should fire on the next tick";
+    EXPECT_EQ(clock.firedAt[1], 1);
+    EXPECT_EQ(clock.firedAt[5], 5);
+    EXPECT_EQ(clock.firedAt[8], 8);
+    EXPECT_EQ(clock.firedAt[63], 63);
+    EXPECT_EQ(clock.firedAt[200], 200);
+    EXPECT_EQ(clock.wheel.size(), 0);
+}
+
+TEST(STimerWheel, BeyondOneRotation)
+{
+    VirtualClock<svec::STimerWheel<int, 4, 2, 8>> clock;
+    clock.advance(3);
+    clock.wheel.schedule(50, 1);
+    clock.wheel.schedule(17, 2);
+    clock.advance(100);
+    EXPECT_EQ(clock.firedAt[1], 53) << "Wheel spans 16 ticks, timer should wait for later rotations";
+    EXPECT_EQ(clock.firedAt[2], 20);
+}
+
+TEST(STimerWheel, CancelAndReschedule)
+{
+    VirtualClock<svec::STimerWheel<int, 8, 2, 16>> clock;
+    svec::TimerHandle a = clock.wheel.schedule(10, 1);
+    svec::TimerHandle b = clock.wheel.schedule(10, 2);
+    svec::TimerHandle c = clock.wheel.schedule(10, 3);
+    EXPECT_TRUE(clock.wheel.cancel(a));
+    EXPECT_FALSE(clock.wheel.cancel(a)) << "Cancelled handle should be stale";
+    EXPECT_TRUE(clock.wheel.reschedule(c, 30));
+
+    clock.advance(10);
+    EXPECT_EQ(clock.firedAt.count(1), 0);
+    EXPECT_EQ(clock.firedAt[2], 10);
+    EXPECT_FALSE(clock.wheel.pending(b)) << "Fired handle should be stale";
+    EXPECT_FALSE(clock.wheel.cancel(b));
+
+    svec::TimerHandle reused = clock.wheel.schedule(5, 4);
+    EXPECT_FALSE(clock.wheel.cancel(a)) << "Handle should not cancel a new timer reusing its slot";
+    EXPECT_TRUE(clock.wheel.pending(reused));
+
+    clock.advance(30);
+    EXPECT_EQ(clock.firedAt[3], 30);
+    EXPECT_EQ(clock.firedAt[4], 15);
+}
+
+TEST(STimerWheel, FullBucket)
+{
+    svec::STimerWheel<int, 8, 2, 2> wheel;
+    EXPECT_TRUE(wheel.schedule(3, 1).valid());
+    EXPECT_TRUE(wheel.schedule(3, 2).valid());
+    EXPECT_FALSE(wheel.schedule(3, 3).valid()) << "Full bucket should refuse timer";
+    EXPECT_TRUE(wheel.schedule(4, 3).valid());
+}
+
+TEST(STimerWheel, CascadeIntoFullBucket)
+{
+    VirtualClock<svec::STimerWheel<int, 16, 3, 2>> clock;
+    EXPECT_TRUE(clock.wheel.schedule(271, 1).valid());
+    EXPECT_TRUE(clock.wheel.schedule(271, 2).valid());
+    clock.advance(16);
+    EXPECT_TRUE(clock.wheel.schedule(255, 3).valid());
+    EXPECT_EQ(clock.wheel.size(), 3);
+
+    // Cascading at tick 256 finds the level 0 bucket of tick 271 full, the timer that does not fit fires late
+    clock.advance(400 - 16);
+    EXPECT_EQ(clock.wheel.size(), 0);
+    ASSERT_EQ(clock.firedAt.size(), 3);
+    EXPECT_GE(clock.firedAt[1], 271);
+    EXPECT_GE(clock.firedAt[2], 271);
+    EXPECT_GE(clock.firedAt[3], 271);
+}
+
+TEST(STimerWheel, RandomAgainstMultimap)
+{
+    VirtualClock<svec::STimerWheel<int, 16, 3, 1024, 16384>> clock;
+    std::multimap<uint64_t, int> expected;
+    std::vector<std::pair<svec::TimerHandle, int>> handles;
+    std::mt19937 random(41);
+    for (int i = 0; i < 20000; i++)
+    {
+        uint64_t delay = random() % 3 == 0 ? random() % 8000 : random() % 40;
+        svec::TimerHandle handle = clock.wheel.schedule(delay, i);
+        ASSERT_TRUE(handle.valid());
+        handles.emplace_back(handle, i);
+        expected.emplace(clock.wheel.now() + std::max<uint64_t>(delay, 1), i);
+
+        if (random() % 4 == 0)
+        {
+            auto [cancelHandle, payload] = handles[random() % handles.size()];
+            auto it = std::find_if(expected.begin(), expected.end(), [&](const auto& entry) { return entry.second == payload; });
+            bool cancelled = clock.wheel.cancel(cancelHandle);
+            bool fired = clock.firedAt.count(payload) > 0;
+            ASSERT_EQ(cancelled, !fired && it != expected.end());
+            if (cancelled)
+            {
+                expected.erase(it);
+            }
+        }
+        if (i % 3 == 0)
+        {
+            clock.advance(1);
+        }
+    }
+    clock.advance(20000);
+    EXPECT_EQ(clock.wheel.size(), 0);
+    for (const auto& [deadline, payload] : expected)
+    {
+        ASSERT_EQ(clock.firedAt.count(payload), 1) << "Payload " << payload;
+        ASSERT_EQ(clock.firedAt[payload], deadline) << "Payload " << payload;
+    }
+    EXPECT_EQ(clock.firedAt.size(), expected.size());
+}
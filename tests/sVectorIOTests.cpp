@@ -0,0 +1,143 @@
+// Copyright 2025 Dalton Prokosch
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gtest/gtest.h"
+#include "sVectorIO.hpp"
+
+#include <cstdlib>
+#include <string>
+
+TEST(SVectorResize, ResizeForOverwrite)
+{
+    svec::SVector<char, 16> SVector({'a', 'b'});
+    SVector.resizeForOverwrite(5);
+    ASSERT_EQ(SVector.size(), 5);
+    EXPECT_EQ(SVector[0], 'a');
+    EXPECT_EQ(SVector[1], 'b');
+
+    memcpy(SVector.data() + 2, "cde", 3);
+    EXPECT_EQ(std::string(SVector.data(), SVector.size()), "abcde");
+
+    SVector.resizeForOverwrite(1);
+    EXPECT_EQ(SVector.size(), 1);
+    EXPECT_EQ(SVector[0], 'a');
+}
+
+TEST(SVectorResize, ResizeForOverwriteNonTrivial)
+{
+    svec::SVector<std::string, 4> SVector({"a"});
+    SVector.resizeForOverwrite(3);
+    ASSERT_EQ(SVector.size(), 3);
+    EXPECT_EQ(SVector[0], "a");
+    EXPECT_TRUE(SVector[1].empty()) << "Non trivial types should be default constructed!";
+    EXPECT_TRUE(SVector[2].empty()) << "Non trivial types should be default constructed!";
+}
+
+TEST(SVectorIO, PipeRoundTrip)
+{
+    int fds[2];
+    ASSERT_EQ(pipe(fds), 0);
+
+    svec::SVector<char, 32> out({'h', 'e', 'l', 'l', 'o'});
+    EXPECT_EQ(svec::writeTo(fds[1], out), 5);
+    EXPECT_EQ(svec::writeTo(fds[1], out, 3), 2);
+
+    svec::SVector<char, 32> in({'>'});
+    EXPECT_EQ(svec::readFrom(fds[0], in), 7);
+    EXPECT_EQ(std::string(in.data(), in.size()), ">hellolo");
+
+    close(fds[0]);
+    close(fds[1]);
+}
+
+#ifdef _DEBUG
+TEST(SVectorIO, WriteToOffsetPastSizeThrows)
+{
+    int fds[2];
+    ASSERT_EQ(pipe(fds), 0);
+
+    svec::SVector<char, 32> out({'h', 'i'});
+    EXPECT_EQ(svec::writeTo(fds[1], out, 2), 0);
+    EXPECT_THROW(svec::writeTo(fds[1], out, 3), std::out_of_range);
+
+    close(fds[0]);
+    close(fds[1]);
+}
+#endif // _DEBUG end
+
+TEST(SVectorIO, ReadFromStopsAtCapacity)
+{
+    int fds[2];
+    ASSERT_EQ(pipe(fds), 0);
+
+    svec::SVector<char, 8> out({'0', '1', '2', '3', '4', '5', '6', '7'});
+    ASSERT_EQ(svec::writeTo(fds[1], out), 8);
+
+    svec::SVector<char, 4> in({'x', 'y'});
+    EXPECT_EQ(svec::readFrom(fds[0], in), 2);
+    EXPECT_EQ(std::string(in.data(), in.size()), "xy01");
+    EXPECT_EQ(svec::readFrom(fds[0], in), 0) << "Full SVector should not read";
+
+    close(fds[0]);
+    close(fds[1]);
+}
+
+TEST(SVectorIO, ReadFromEndOfFile)
+{
+    int fds[2];
+    ASSERT_EQ(pipe(fds), 0);
+    close(fds[1]);
+
+    svec::SVector<char, 8> in({'a'});
+    EXPECT_EQ(svec::readFrom(fds[0], in), 0);
+    EXPECT_EQ(in.size(), 1);
+
+    close(fds[0]);
+}
+
+TEST(SVectorIO, ReadFromBadDescriptor)
+{
+    svec::SVector<char, 8> in({'a'});
+    EXPECT_EQ(svec::readFrom(-1, in), -1);
+    EXPECT_EQ(in.size(), 1) << "Failed read should not grow SVector";
+}
+
+TEST(SVectorIO, ScatterGatherTempFile)
+{
+    char path[] = "/tmp/sVectorIOTestsXXXXXX";
+    int fd = mkstemp(path);
+    ASSERT_NE(fd, -1);
+    unlink(path);
+
+    svec::SVector<char, 4> header({'H', 'D', 'R', ':'});
+    svec::SVector<char, 16> body({'p', 'a', 'y', 'l', 'o', 'a', 'd'});
+    svec::SVector<int, 2> trailer({1, 2});
+    EXPECT_EQ(svec::writev(fd, header, body, trailer), static_cast<ssize_t>(4 + 7 + sizeof(int) * 2));
+
+    ASSERT_EQ(lseek(fd, 0, SEEK_SET), 0);
+
+    svec::SVector<char, 6> first({'#'});
+    svec::SVector<unsigned char, 64> second;
+    EXPECT_EQ(svec::readv(fd, first, second), static_cast<ssize_t>(4 + 7 + sizeof(int) * 2));
+    EXPECT_EQ(std::string(first.data(), first.size()), "#HDR:p");
+    ASSERT_EQ(second.size(), 6 + sizeof(int) * 2);
+    EXPECT_EQ(std::string(reinterpret_cast<const char*>(second.data()), 6), "ayload");
+
+    int values[2];
+    memcpy(values, second.data() + 6, sizeof(values));
+    EXPECT_EQ(values[0], 1);
+    EXPECT_EQ(values[1], 2);
+
+    close(fd);
+}
@@ -15,6 +15,15 @@
 #include "gtest/gtest.h"
 #include "sVector.hpp"
 
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <set>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
 TEST(SVectorConstructor, DefaultConstructor) 
 {
     svec::SVector<int, 10> SVector;
@@ -222,6 +231,34 @@ TEST(SVectorIterator, EndConst)
     EXPECT_EQ(*(iterator - 1), 5);
 }
 
+static_assert(std::random_access_iterator<svec::SVector<int, 10>::Iterator>);
+static_assert(std::random_access_iterator<svec::SVector<int, 10>::ConstIterator>);
+static_assert(std::is_same_v<std::iterator_traits<svec::SVector<std::string, 10>::ConstIterator>::value_type, std::string>);
+
+TEST(SVectorIterator, RandomAccess)
+{
+    svec::SVector<int, 10> SVector({5, 3, 9, 1, 7});
+    svec::SVector<int, 10>::Iterator first = SVector.begin();
+    svec::SVector<int, 10>::Iterator last = SVector.end();
+    EXPECT_TRUE(first < last);
+    EXPECT_TRUE(first <= first);
+    EXPECT_FALSE(last < first);
+    EXPECT_TRUE(last > first);
+    EXPECT_EQ(last - first, 5);
+    EXPECT_EQ(*(2 + first), 9);
+    EXPECT_EQ(first[3], 1);
+
+    std::sort(first, last);
+    EXPECT_TRUE(SVector == (svec::SVector<int, 10>{1, 3, 5, 7, 9}));
+    EXPECT_EQ(std::lower_bound(SVector.begin(), SVector.end(), 6) - SVector.begin(), 3);
+
+    svec::SVector<int, 10>::ConstIterator constFirst = first;
+    EXPECT_EQ(*constFirst, 1);
+    svec::SVector<int, 10>::Iterator unset;
+    unset = last;
+    EXPECT_TRUE(unset == SVector.end());
+}
+
 TEST(SVectorSet, PushBack)
 {
     svec::SVector<int, 10> SVectorA({1, 2, 3, 4});
@@ -231,6 +268,59 @@ TEST(SVectorSet, PushBack)
     EXPECT_EQ(SVectorA, SVectorB);
 }
 
+TEST(SVectorSet, TryPushBack)
+{
+    svec::SVector<int, 3> SVectorA({1, 2});
+
+    int* added = SVectorA.tryPushBack(3);
+    ASSERT_NE(added, nullptr);
+    EXPECT_EQ(*added, 3);
+    EXPECT_EQ(SVectorA.tryPushBack(4), nullptr) << "Full SVector should refuse element";
+    EXPECT_EQ(SVectorA.tryEmplaceBack(5), nullptr);
+
+    svec::SVector<int, 3> SVectorB({1, 2, 3});
+    EXPECT_EQ(SVectorA, SVectorB);
+}
+
+TEST(SVectorSet, UncheckedPushBack)
+{
+    svec::SVector<int, 4> SVectorA;
+    SVectorA.uncheckedPushBack(1);
+    SVectorA.uncheckedEmplaceBack(2);
+
+    svec::SVector<int, 4> SVectorB({1, 2});
+    EXPECT_EQ(SVectorA, SVectorB);
+}
+
+TEST(SVectorSet, Resize)
+{
+    svec::SVector<int, 10> SVectorA({1, 2, 3});
+
+    SVectorA.resize(5);
+    svec::SVector<int, 10> SVectorB({1, 2, 3, 0, 0});
+    EXPECT_EQ(SVectorA, SVectorB) << "New elements should be value initialized";
+
+    SVectorA.resize(7, 9);
+    svec::SVector<int, 10> SVectorC({1, 2, 3, 0, 0, 9, 9});
+    EXPECT_EQ(SVectorA, SVectorC);
+
+    SVectorA.resize(2);
+    svec::SVector<int, 10> SVectorD({1, 2});
+    EXPECT_EQ(SVectorA, SVectorD);
+}
+
+TEST(SVectorSet, ReserveAndClear)
+{
+    static_assert((svec::SVector<int, 10>::reserve(10), true), "reserve within capacity is a constant expression");
+    EXPECT_THROW((svec::SVector<int, 10>::reserve(11)), std::length_error);
+
+    svec::SVector<int, 10> SVectorA({1, 2, 3});
+    SVectorA.clear();
+    EXPECT_EQ(SVectorA.size(), 0);
+    SVectorA.pushBack(4);
+    EXPECT_EQ(SVectorA.front(), 4);
+}
+
 TEST(SVectorSet, PushFront)
 {
     svec::SVector<int, 10> SVectorA({2, 3, 4, 5});
@@ -394,8 +484,6 @@ TEST(SVectorSFINAE, GenericTest)
     EXPECT_EQ(SVector.size(), 1);
 }
 
-#include <algorithm>
-
 TEST(SVectorAlgorithm, FindMut)
 {
     svec::SVector<int, 10> SVector({1, 2, 3, 4, 5});
@@ -421,4 +509,401 @@ TEST(SVectorAlgorithm, HeapSort)
     std::sort_heap(SVectorA.begin(), SVectorA.end());
 
     EXPECT_EQ(SVectorA, SVectorB);
-}
\ No newline at end of file
+}
+
+struct CopyMoveCounter
+{
+    CopyMoveCounter() : value(0) { alive++; }
+    CopyMoveCounter(int value) : value(value) { alive++; }
+    CopyMoveCounter(const CopyMoveCounter& other) : value(other.value) { copies++; alive++; }
+    CopyMoveCounter(CopyMoveCounter&& other) : value(other.value) { moves++; alive++; }
+    ~CopyMoveCounter() { alive--; }
+    CopyMoveCounter& operator=(const CopyMoveCounter& other) { value = other.value; copies++; return *this; }
+    CopyMoveCounter& operator=(CopyMoveCounter&& other) { value = other.value; moves++; return *this; }
+    bool operator==(const CopyMoveCounter& other) const { return value == other.value; }
+
+    static void reset()
+    {
+        copies = 0;
+        moves = 0;
+    }
+
+    int value;
+    static inline int copies = 0;
+    static inline int moves = 0;
+    static inline int alive = 0;
+};
+
+TEST(SVectorMove, PushBackRValueMoves)
+{
+    svec::SVector<CopyMoveCounter, 10> SVector;
+    CopyMoveCounter::reset();
+
+    SVector.pushBack(CopyMoveCounter(1));
+    CopyMoveCounter element(2);
+    SVector.pushBack(std::move(element));
+
+    EXPECT_EQ(CopyMoveCounter::copies, 0) << "pushBack(T&&) copied instead of moving!";
+    EXPECT_EQ(CopyMoveCounter::moves, 2);
+    svec::SVector<CopyMoveCounter, 10> expected({1, 2});
+    EXPECT_EQ(SVector, expected);
+}
+
+TEST(SVectorMove, PushFrontAndInsertMove)
+{
+    svec::SVector<CopyMoveCounter, 10> SVector({1, 3});
+    CopyMoveCounter::reset();
+
+    SVector.pushFront(CopyMoveCounter(0));
+    SVector.insert(2, CopyMoveCounter(2));
+
+    EXPECT_EQ(CopyMoveCounter::copies, 0) << "Shifting or inserting copied instead of moving!";
+    svec::SVector<CopyMoveCounter, 10> expected({0, 1, 2, 3});
+    EXPECT_EQ(SVector, expected);
+}
+
+TEST(SVectorMove, EmplaceBackConstructsInPlace)
+{
+    svec::SVector<CopyMoveCounter, 10> SVector;
+    CopyMoveCounter::reset();
+
+    CopyMoveCounter& element = SVector.emplaceBack(7);
+
+    EXPECT_EQ(CopyMoveCounter::copies, 0);
+    EXPECT_EQ(CopyMoveCounter::moves, 0) << "emplaceBack did not construct in place!";
+    EXPECT_EQ(&element, &SVector.back()) << "emplaceBack did not return a reference to the new element!";
+    EXPECT_EQ(element.value, 7);
+}
+
+TEST(SVectorMove, EmplaceMiddleOnlyMoves)
+{
+    svec::SVector<CopyMoveCounter, 10> SVector({1, 2, 4, 5});
+    CopyMoveCounter::reset();
+
+    CopyMoveCounter& element = SVector.emplace(2, 3);
+
+    EXPECT_EQ(CopyMoveCounter::copies, 0);
+    EXPECT_EQ(&element, &SVector[2]);
+    svec::SVector<CopyMoveCounter, 10> expected({1, 2, 3, 4, 5});
+    EXPECT_EQ(SVector, expected);
+}
+
+TEST(SVectorMove, EraseAndPopFrontOnlyMove)
+{
+    svec::SVector<CopyMoveCounter, 10> SVector({1, 2, 3, 4, 5});
+    CopyMoveCounter::reset();
+
+    SVector.erase(2);
+    SVector.popFront();
+
+    EXPECT_EQ(CopyMoveCounter::copies, 0);
+    svec::SVector<CopyMoveCounter, 10> expected({2, 4, 5});
+    EXPECT_EQ(SVector, expected);
+}
+
+TEST(SVectorMove, MoveConstructorMovesElements)
+{
+    svec::SVector<CopyMoveCounter, 10> SVectorA({1, 2, 3});
+    CopyMoveCounter::reset();
+
+    svec::SVector<CopyMoveCounter, 10> SVectorB(std::move(SVectorA));
+
+    EXPECT_EQ(CopyMoveCounter::copies, 0);
+    EXPECT_EQ(CopyMoveCounter::moves, 3) << "Move constructor touched more than the live elements!";
+    svec::SVector<CopyMoveCounter, 10> expected({1, 2, 3});
+    EXPECT_EQ(SVectorB, expected);
+}
+
+TEST(SVectorMove, ElementsAreDestroyed)
+{
+    int aliveBefore = CopyMoveCounter::alive;
+    {
+        svec::SVector<CopyMoveCounter, 10> SVector({1, 2, 3});
+        SVector.popBack();
+        SVector.emplaceBack(4);
+        EXPECT_EQ(CopyMoveCounter::alive, aliveBefore + 3) << "Unused slots should not hold constructed elements!";
+
+        SVector = svec::SVector<CopyMoveCounter, 10>({5});
+        EXPECT_EQ(CopyMoveCounter::alive, aliveBefore + 1);
+    }
+    EXPECT_EQ(CopyMoveCounter::alive, aliveBefore) << "Destructor leaked elements!";
+}
+
+TEST(SVectorMove, MoveOnlyType)
+{
+    svec::SVector<std::unique_ptr<int>, 10> SVector;
+    SVector.pushBack(std::make_unique<int>(2));
+    SVector.emplaceBack(new int(4));
+    SVector.pushFront(std::make_unique<int>(1));
+    SVector.insert(2, std::make_unique<int>(3));
+    SVector.emplace(4, new int(5));
+
+    ASSERT_EQ(SVector.size(), 5);
+    for (size_t i = 0; i < SVector.size(); i++)
+    {
+        EXPECT_EQ(*SVector[i], static_cast<int>(i) + 1);
+    }
+
+    SVector.erase(0);
+    SVector.popFront();
+    SVector.popBack();
+    ASSERT_EQ(SVector.size(), 2);
+    EXPECT_EQ(*SVector[0], 3);
+    EXPECT_EQ(*SVector[1], 4);
+
+    svec::SVector<std::unique_ptr<int>, 10> moved(std::move(SVector));
+    EXPECT_EQ(*moved[1], 4);
+}
+
+TEST(SVectorMove, StringPayload)
+{
+    svec::SVector<std::string, 4> SVector;
+    std::string longString(64, 'a');
+    SVector.pushBack(std::move(longString));
+    SVector.emplaceBack(32, 'b');
+    SVector.pushFront("front");
+
+    EXPECT_EQ(SVector[0], "front");
+    EXPECT_EQ(SVector[1], std::string(64, 'a'));
+    EXPECT_EQ(SVector[2], std::string(32, 'b'));
+}
+
+TEST(SVectorMove, TryPushBackDoesNotMoveWhenFull)
+{
+    svec::SVector<std::string, 1> SVector({"a"});
+    std::string element = "not moved";
+
+    EXPECT_EQ(SVector.tryPushBack(std::move(element)), nullptr);
+    EXPECT_EQ(element, "not moved");
+}
+
+TEST(SVectorMove, ClearDestroysElements)
+{
+    int aliveBefore = CopyMoveCounter::alive;
+    svec::SVector<CopyMoveCounter, 4> SVector;
+    SVector.emplaceBack(1);
+    SVector.emplaceBack(2);
+    SVector.resize(3);
+    EXPECT_EQ(CopyMoveCounter::alive, aliveBefore + 3);
+
+    SVector.clear();
+    EXPECT_EQ(CopyMoveCounter::alive, aliveBefore);
+}
+
+struct NoexceptMoveCounter : CopyMoveCounter
+{
+    using CopyMoveCounter::CopyMoveCounter;
+    NoexceptMoveCounter(const NoexceptMoveCounter&) = default;
+    NoexceptMoveCounter(NoexceptMoveCounter&& other) noexcept : CopyMoveCounter(std::move(other)) {}
+    NoexceptMoveCounter& operator=(const NoexceptMoveCounter&) = default;
+    NoexceptMoveCounter& operator=(NoexceptMoveCounter&& other) noexcept
+    {
+        CopyMoveCounter::operator=(std::move(other));
+        return *this;
+    }
+};
+
+using TrivialVector = svec::SVector<int, 8>;
+static_assert(std::is_trivially_copyable_v<TrivialVector>);
+static_assert(std::is_trivially_copy_constructible_v<TrivialVector>);
+static_assert(std::is_trivially_move_constructible_v<TrivialVector>);
+static_assert(std::is_trivially_copy_assignable_v<TrivialVector>);
+static_assert(std::is_trivially_move_assignable_v<TrivialVector>);
+static_assert(std::is_trivially_destructible_v<TrivialVector>);
+static_assert(std::is_nothrow_move_constructible_v<TrivialVector>);
+static_assert(std::is_trivially_copyable_v<svec::SPaddedVector<double, 4>>);
+static_assert(std::is_trivially_copyable_v<svec::SVector<TrivialVector, 4>>, "Triviality should propagate through nesting");
+
+using StringVector = svec::SVector<std::string, 8>;
+static_assert(!std::is_trivially_copyable_v<StringVector>);
+static_assert(!std::is_trivially_destructible_v<StringVector>);
+static_assert(std::is_nothrow_move_constructible_v<StringVector>);
+static_assert(std::is_nothrow_move_assignable_v<StringVector>);
+static_assert(std::is_nothrow_destructible_v<StringVector>);
+static_assert(!std::is_nothrow_copy_constructible_v<StringVector>);
+static_assert(!std::is_nothrow_copy_assignable_v<StringVector>);
+
+static_assert(!std::is_nothrow_move_constructible_v<svec::SVector<CopyMoveCounter, 4>>);
+static_assert(std::is_nothrow_move_constructible_v<svec::SVector<NoexceptMoveCounter, 4>>);
+static_assert(std::is_nothrow_move_constructible_v<svec::SVector<std::unique_ptr<int>, 4>>);
+static_assert(!std::is_copy_constructible_v<svec::SVector<std::unique_ptr<int>, 4>>);
+
+TEST(SVectorMove, AssignmentChains)
+{
+    svec::SVector<int, 4> a;
+    svec::SVector<int, 4> b;
+    svec::SVector<int, 4> c = {1, 2, 3};
+    a = b = c;
+    EXPECT_EQ(a, c);
+    EXPECT_EQ(b, c);
+
+    StringVector d;
+    StringVector e;
+    (d = e = {"x", "y"}).pushBack("z");
+    EXPECT_EQ(d, (StringVector{"x", "y", "z"}));
+    EXPECT_EQ(e, (StringVector{"x", "y"}));
+}
+
+TEST(SVectorMove, TrivialCopyKeepsElements)
+{
+    TrivialVector a = {1, 2, 3};
+    TrivialVector b = a;
+    TrivialVector c;
+    c = std::move(b);
+    c.pushBack(4);
+    EXPECT_EQ(c, (TrivialVector{1, 2, 3, 4}));
+    EXPECT_EQ(a, (TrivialVector{1, 2, 3}));
+}
+
+TEST(SVectorMove, StdVectorGrowthMoves)
+{
+    std::vector<svec::SVector<NoexceptMoveCounter, 4>> grown;
+    CopyMoveCounter::reset();
+    for (int i = 0; i < 100; i++)
+    {
+        grown.emplace_back();
+        grown.back().emplaceBack(i);
+    }
+    EXPECT_EQ(CopyMoveCounter::copies, 0) << "std::vector copied SVectors while growing instead of moving them";
+    EXPECT_GT(CopyMoveCounter::moves, 0);
+    EXPECT_EQ(grown[42][0].value, 42);
+}
+
+TEST(SVectorAlignment, DefaultAlignment)
+{
+    EXPECT_EQ(alignof(svec::SVector<char, 3>), alignof(size_t));
+    EXPECT_EQ(alignof(svec::SVector<double, 3>), alignof(double));
+}
+
+TEST(SVectorAlignment, SIMDAlignment)
+{
+    svec::SVector<float, 64, 32> SVectorA({1.0f, 2.0f});
+    svec::SVector<float, 64, 32> SVectorB[3];
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(SVectorA.data()) % 32, 0);
+    for (auto& SVector : SVectorB)
+    {
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(SVector.data()) % 32, 0) << "Every element array should be aligned";
+    }
+
+    svec::SVector<float, 64> SVectorC({1.0f, 2.0f});
+    EXPECT_EQ(SVectorA, SVectorC) << "SVectors with different alignments should still be comparable";
+
+    svec::SVector<float, 64, 32> SVectorD = SVectorA;
+    EXPECT_EQ(SVectorD, SVectorA);
+}
+
+TEST(SVectorAlignment, PaddedVector)
+{
+    EXPECT_EQ(sizeof(svec::SPaddedVector<int, 3>) % svec::CACHE_LINE_SIZE, 0);
+    EXPECT_EQ(alignof(svec::SPaddedVector<int, 3>), svec::CACHE_LINE_SIZE);
+
+    svec::SPaddedVector<int, 3> perThread[4];
+    for (size_t i = 0; i + 1 < 4; i++)
+    {
+        uintptr_t lastByte = reinterpret_cast<uintptr_t>(&perThread[i]) + sizeof(perThread[i]) - 1;
+        uintptr_t nextFirstByte = reinterpret_cast<uintptr_t>(&perThread[i + 1]);
+        EXPECT_NE(lastByte / svec::CACHE_LINE_SIZE, nextFirstByte / svec::CACHE_LINE_SIZE) << "Neighbouring SVectors share a cache line";
+    }
+
+    perThread[1].pushBack(5);
+    EXPECT_EQ(perThread[1].back(), 5);
+}
+
+TEST(SVectorHash, EqualVectorsHashEqual)
+{
+    std::hash<svec::SVector<uint32_t, 8>> hash8;
+    std::hash<svec::SVector<uint32_t, 16>> hash16;
+    svec::SVector<uint32_t, 8> a = {1, 2, 3};
+    svec::SVector<uint32_t, 16> b = {1, 2, 3};
+    EXPECT_EQ(hash8(a), hash16(b)) << "Capacity should not take part in the hash";
+
+    a.pushBack(4);
+    a.popBack();
+    EXPECT_EQ(hash8(a), hash16(b)) << "Spare capacity should not take part in the hash";
+
+    std::hash<svec::SVector<std::string, 4>> stringHash;
+    svec::SVector<std::string, 4> c = {"a", "bc"};
+    svec::SVector<std::string, 4> d = {"a", "bc"};
+    EXPECT_EQ(stringHash(c), stringHash(d));
+    d[1] = "cb";
+    EXPECT_NE(stringHash(c), stringHash(d));
+}
+
+TEST(SVectorHash, DistinguishesSizesAndValues)
+{
+    std::unordered_set<size_t> hashes;
+    std::hash<svec::SVector<uint8_t, 64>> hash;
+    svec::SVector<uint8_t, 64> vec;
+    for (size_t size = 0; size < 64; size++)
+    {
+        EXPECT_TRUE(hashes.insert(hash(vec)).second) << "Zero filled vectors of different sizes collided at " << size;
+        for (size_t i = 0; i < vec.size(); i++)
+        {
+            vec[i] ^= 1;
+            EXPECT_TRUE(hashes.insert(hash(vec)).second) << "Flipping byte " << i << " of " << size << " collided";
+            vec[i] ^= 1;
+        }
+        vec.pushBack(0);
+    }
+}
+
+TEST(SVectorHash, UnorderedSetKey)
+{
+    std::unordered_set<svec::SVector<uint32_t, 8>> set;
+    for (uint32_t i = 0; i < 1'000; i++)
+    {
+        set.insert({i, i * 7, i % 3});
+    }
+    set.insert({5, 35, 2});
+    EXPECT_EQ(set.size(), 1'000);
+    EXPECT_TRUE(set.contains({999, 6'993, 0}));
+    EXPECT_FALSE(set.contains({999, 6'993}));
+}
+
+TEST(SVectorHash, Multiply128)
+{
+    uint64_t high;
+    EXPECT_EQ(svec::hashing::multiply128(UINT64_MAX, UINT64_MAX, high), 1);
+    EXPECT_EQ(high, UINT64_MAX - 1);
+    EXPECT_EQ(svec::hashing::multiply128(0x1'0000'0000, 0x1'0000'0000, high), 0);
+    EXPECT_EQ(high, 1);
+    EXPECT_EQ(svec::hashing::multiply128(0x1234'5678'9ABC'DEF0, 3, high), 0x369D'0369'D036'9CD0);
+    EXPECT_EQ(high, 0);
+}
+
+TEST(SVectorCompare, ThreeWay)
+{
+    svec::SVector<int, 8> a = {1, 2, 3};
+    svec::SVector<int, 4> b = {1, 2, 4};
+    svec::SVector<int, 8> prefix = {1, 2};
+    svec::SVector<int, 8> negative = {-1, 5};
+
+    EXPECT_EQ(a <=> b, std::strong_ordering::less);
+    EXPECT_EQ(b <=> a, std::strong_ordering::greater);
+    EXPECT_EQ(a <=> a, std::strong_ordering::equal);
+    EXPECT_TRUE(prefix < a);
+    EXPECT_TRUE(negative < prefix);
+    EXPECT_TRUE(a >= prefix);
+
+    svec::SVector<double, 4> x = {1.0, 2.0};
+    svec::SVector<double, 4> y = {1.0, std::numeric_limits<double>::quiet_NaN()};
+    EXPECT_EQ(x <=> y, std::partial_ordering::unordered);
+}
+
+TEST(SVectorCompare, BytesUseUnsignedOrder)
+{
+    svec::SVector<uint8_t, 8> low = {0x01, 0x7F};
+    svec::SVector<uint8_t, 8> high = {0x01, 0x80};
+    svec::SVector<uint8_t, 8> longer = {0x01, 0x7F, 0x00};
+    EXPECT_TRUE(low < high);
+    EXPECT_TRUE(low < longer);
+    EXPECT_TRUE(longer < high);
+
+    svec::SVector<std::string, 4> words = {"b", "a"};
+    svec::SVector<std::string, 4> other = {"b", "b"};
+    EXPECT_TRUE(words < other);
+
+    std::set<svec::SVector<uint8_t, 8>> ordered = {high, longer, low};
+    EXPECT_EQ(*ordered.begin(), low);
+    EXPECT_EQ(*ordered.rbegin(), high);
+}
@@ -0,0 +1,122 @@
+// Copyright 2025 Dalton Prokosch
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gtest/gtest.h"
+#include "sWindow.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <vector>
+
+struct Gcd
+{
+    uint32_t operator()(uint32_t a, uint32_t b) const
+    {
+        return std::gcd(a, b);
+    }
+};
+template<typename T, size_t N>
+using WindowGcd = svec::WindowAggregate<T, N, Gcd>;
+
+struct Concatenate
+{
+    std::string operator()(const std::string& older, const std::string& newer) const
+    {
+        return older + newer;
+    }
+};
+template<typename T, size_t N>
+using WindowConcatenate = svec::WindowAggregate<T, N, Concatenate>;
+
+TEST(SWindow, RingOrder)
+{
+    svec::SWindow<int, 3> window;
+    window.push(1);
+    window.push(2);
+    EXPECT_EQ(window.size(), 2);
+    EXPECT_FALSE(window.full());
+    EXPECT_EQ(window.oldest(), 1);
+    EXPECT_EQ(window.newest(), 2);
+
+    window.push(3);
+    window.push(4);
+    EXPECT_TRUE(window.full());
+    EXPECT_EQ(window[0], 2);
+    EXPECT_EQ(window[1], 3);
+    EXPECT_EQ(window[2], 4);
+    EXPECT_EQ(window.pushed(), 4);
+}
+
+TEST(SWindow, MinMaxSum)
+{
+    svec::SWindow<int, 3, svec::WindowMin, svec::WindowMax, svec::WindowSum> window;
+    int expectedMin[] = {5, 1, 1, 1, 2, 2, 0};
+    int expectedMax[] = {5, 5, 5, 4, 4, 7, 7};
+    int values[] = {5, 1, 4, 2, 3, 7, 0};
+    for (int i = 0; i < 7; i++)
+    {
+        window.push(values[i]);
+        EXPECT_EQ(window.get<svec::WindowMin>().value(), expectedMin[i]) << "After " << i;
+        EXPECT_EQ(window.get<svec::WindowMax>().value(), expectedMax[i]) << "After " << i;
+    }
+    EXPECT_EQ(window.get<svec::WindowSum>().value(), 10);
+    EXPECT_DOUBLE_EQ(window.get<svec::WindowSum>().mean(), 10.0 / 3.0);
+
+    window.clear();
+    window.push(9);
+    EXPECT_EQ(window.get<svec::WindowMin>().value(), 9);
+    EXPECT_EQ(window.get<svec::WindowSum>().value(), 9);
+}
+
+TEST(SWindow, AggregateKeepsOrder)
+{
+    svec::SWindow<std::string, 3, WindowConcatenate> window;
+    for (const char* value : {"a", "b", "c", "d", "e"})
+    {
+        window.push(value);
+    }
+    EXPECT_EQ(window.get<WindowConcatenate>().value(), "cde") << "Older values should be the left operand";
+}
+
+TEST(SWindow, RandomAgainstScan)
+{
+    constexpr size_t N = 37;
+    svec::SWindow<uint32_t, N, svec::WindowMin, svec::WindowMax, svec::WindowSum, svec::WindowVariance, WindowGcd> window;
+    std::vector<uint32_t> history;
+    std::mt19937 random(40);
+    for (int i = 0; i < 5000; i++)
+    {
+        uint32_t value = (random() % 50 + 1) * 6;
+        window.push(value);
+        history.push_back(value);
+
+        auto first = history.end() - std::min(history.size(), N);
+        auto last = history.end();
+        ASSERT_EQ(window.get<svec::WindowMin>().value(), *std::min_element(first, last));
+        ASSERT_EQ(window.get<svec::WindowMax>().value(), *std::max_element(first, last));
+        uint64_t sum = std::accumulate(first, last, uint64_t(0));
+        ASSERT_EQ(window.get<svec::WindowSum>().value(), sum);
+        ASSERT_EQ(window.get<WindowGcd>().value(), std::accumulate(first, last, uint32_t(0), Gcd()));
+
+        double mean = static_cast<double>(sum) / (last - first);
+        double squares = 0;
+        for (auto it = first; it != last; it++)
+        {
+            squares += (*it - mean) * (*it - mean);
+        }
+        ASSERT_NEAR(window.get<svec::WindowVariance>().mean(), mean, 1e-6);
+        ASSERT_NEAR(window.get<svec::WindowVariance>().value(), squares / (last - first), 1e-6);
+    }
+}
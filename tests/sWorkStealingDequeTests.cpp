@@ -0,0 +1,139 @@
+// Copyright 2025 Dalton Prokosch
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gtest/gtest.h"
+#include "sWorkStealingDeque.hpp"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+TEST(SWorkStealingDeque, OwnerIsLifoThievesAreFifo)
+{
+    svec::SWorkStealingDeque<int, 8> deque;
+    EXPECT_FALSE(deque.pop().has_value());
+    EXPECT_FALSE(deque.steal().has_value());
+
+    for (int i = 1; i <= 4; i++)
+    {
+        EXPECT_TRUE(deque.push(i));
+    }
+    EXPECT_EQ(deque.size(), 4);
+    EXPECT_EQ(deque.pop(), 4);
+    EXPECT_EQ(deque.steal(), 1);
+    EXPECT_EQ(deque.pop(), 3);
+    EXPECT_EQ(deque.steal(), 2);
+    EXPECT_TRUE(deque.empty());
+}
+
+TEST(SWorkStealingDeque, FullAndWrapAround)
+{
+    svec::SWorkStealingDeque<int, 4> deque;
+    for (int round = 0; round < 3; round++)
+    {
+        for (int i = 0; i < 4; i++)
+        {
+            EXPECT_TRUE(deque.push(round * 4 + i));
+        }
+        EXPECT_FALSE(deque.push(-1)) << "Full deque should refuse element";
+        for (int i = 0; i < 4; i++)
+        {
+            EXPECT_EQ(deque.steal(), round * 4 + i);
+        }
+    }
+}
+
+TEST(SWorkStealingDeque, StealBatch)
+{
+    svec::SWorkStealingDeque<int, 16> deque;
+    for (int i = 0; i < 9; i++)
+    {
+        deque.push(i);
+    }
+    int out[8];
+    EXPECT_EQ(deque.stealBatch(std::span<int>(out)), 5) << "Should take half, rounded up";
+    for (int i = 0; i < 5; i++)
+    {
+        EXPECT_EQ(out[i], i);
+    }
+
+    svec::SWorkStealingDeque<int, 2> destination;
+    EXPECT_EQ(deque.stealBatch(destination), 2) << "Should be limited by room in destination";
+    EXPECT_EQ(destination.pop(), 6);
+    EXPECT_EQ(destination.pop(), 5);
+    EXPECT_EQ(deque.size(), 2);
+}
+
+TEST(SWorkStealingDeque, EveryElementTakenOnce)
+{
+    constexpr int ELEMENTS = 200000;
+    svec::SWorkStealingDeque<int, 256> deque;
+    std::vector<std::atomic<int>> taken(ELEMENTS);
+    std::atomic<bool> done{false};
+
+    std::vector<std::thread> thieves;
+    for (int t = 0; t < 3; t++)
+    {
+        thieves.emplace_back([&, t]()
+        {
+            int batch[4];
+            while (!done.load() || !deque.empty())
+            {
+                if (t == 0)
+                {
+                    size_t stolen = deque.stealBatch(std::span<int>(batch));
+                    for (size_t i = 0; i < stolen; i++)
+                    {
+                        taken[batch[i]]++;
+                    }
+                }
+                else if (std::optional<int> element = deque.steal())
+                {
+                    taken[*element]++;
+                }
+            }
+        });
+    }
+
+    for (int i = 0; i < ELEMENTS; i++)
+    {
+        while (!deque.push(i))
+        {
+            if (std::optional<int> element = deque.pop())
+            {
+                taken[*element]++;
+            }
+        }
+        if (i % 3 == 0)
+        {
+            if (std::optional<int> element = deque.pop())
+            {
+                taken[*element]++;
+            }
+        }
+    }
+    while (std::optional<int> element = deque.pop())
+    {
+        taken[*element]++;
+    }
+    done.store(true);
+    for (std::thread& thief : thieves)
+    {
+        thief.join();
+    }
+    for (int i = 0; i < ELEMENTS; i++)
+    {
+        ASSERT_EQ(taken[i].load(), 1) << "Element " << i;
+    }
+}